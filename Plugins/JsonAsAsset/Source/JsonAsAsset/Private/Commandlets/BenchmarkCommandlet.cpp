@@ -0,0 +1,348 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Commandlets/BenchmarkCommandlet.h"
+
+#include "Importers/Constructor/Importer.h"
+#include "Settings/JsonAsAssetSettings.h"
+#include "Utilities/EngineUtilities.h"
+#include "Utilities/ImportMemory.h"
+#include "Utilities/ImportReport.h"
+#include "Utilities/ImportTrace.h"
+#include "Utilities/MaterialCompileBatch.h"
+#include "Utilities/SyntheticExports.h"
+#include "Modules/LogCategory.h"
+
+#include "Animation/PoseAsset.h"
+#include "Animation/Skeleton.h"
+#include "Components/StaticMeshComponent.h"
+#include "Curves/CurveTable.h"
+#include "Engine/DataTable.h"
+#include "Engine/PrimaryAssetLabel.h"
+#include "HAL/FileManager.h"
+#include "Materials/Material.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "PhysicsEngine/PhysicsAsset.h"
+#include "Rendering/ColorVertexBuffer.h"
+#if ENGINE_UE5 && ENGINE_MINOR_VERSION > 4
+#include "PhysicsEngine/SkeletalBodySetup.h"
+#endif
+#include "Sound/SoundCue.h"
+#if ENGINE_UE5 && ENGINE_MINOR_VERSION >= 5
+#include "StructUtils/UserDefinedStruct.h"
+#else
+#include "Engine/UserDefinedStruct.h"
+#endif
+
+/* Differences below this are noise, whatever the threshold */
+static constexpr double GBenchmarkMinimumRegressionSeconds = 0.05;
+
+UJsonAsAssetBenchmarkCommandlet::UJsonAsAssetBenchmarkCommandlet() {
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UJsonAsAssetBenchmarkCommandlet::Main(const FString& Params) {
+	TArray<FString> Tokens, Switches;
+	TMap<FString, FString> ParamsMap;
+	ParseCommandLine(*Params, Tokens, Switches, ParamsMap);
+
+	FSyntheticExportGenerator::FOptions Options; {
+		if (const FString* Seed = ParamsMap.Find(TEXT("Seed"))) Options.Seed = FCString::Atoi(**Seed);
+		if (const FString* Scale = ParamsMap.Find(TEXT("Scale"))) Options.Scale = FMath::Max(FCString::Atof(**Scale), 0.01f);
+		if (const FString* Count = ParamsMap.Find(TEXT("Count"))) Options.AssetsPerType = FMath::Max(FCString::Atoi(**Count), 1);
+		if (const FString* Types = ParamsMap.Find(TEXT("Types"))) Types->ParseIntoArray(Options.Types, TEXT("+"));
+	}
+
+	for (const FString& Type : Options.Types) {
+		if (!FSyntheticExportGenerator::GetSupportedTypes().Contains(Type)) {
+			UE_LOG(LogJsonAsAsset, Error, TEXT("Benchmark: Unsupported type %s (supported: %s)"), *Type, *FString::Join(FSyntheticExportGenerator::GetSupportedTypes(), TEXT(", ")));
+			return 1;
+		}
+	}
+
+	const FString* LabelParam = ParamsMap.Find(TEXT("Label"));
+	const FString Label = LabelParam ? *LabelParam : TEXT("Latest");
+
+	const double Threshold = ParamsMap.Contains(TEXT("Threshold")) ? FCString::Atod(*ParamsMap[TEXT("Threshold")]) : 0.15;
+
+	/* Generate ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	const FString BenchmarkDirectory = FPaths::ProjectSavedDir() / TEXT("JsonAsAsset/Benchmark");
+	const FString ExportsDirectory = FPaths::ConvertRelativePathToFull(BenchmarkDirectory / TEXT("Exports"));
+
+	IFileManager::Get().DeleteDirectory(*ExportsDirectory, false, true);
+
+	const TArray<FSyntheticExport> Exports = FSyntheticExportGenerator::Generate(ExportsDirectory, Options);
+
+	UE_LOG(LogJsonAsAsset, Display, TEXT("Benchmark: Generated %d files (seed %d, scale %.2f) in %s"), Exports.Num(), Options.Seed, Options.Scale, *ExportsDirectory);
+
+	if (Switches.Contains(TEXT("GenerateOnly"))) {
+		return 0;
+	}
+
+	/* Every run has to import everything the same way, whatever the project's settings are */
+	UJsonAsAssetSettings* Settings = GetMutableDefault<UJsonAsAssetSettings>();
+
+	const FString ExportDirectoryCache = Settings->ExportDirectory.Path;
+	const bool bSavePackagesOnImportCache = Settings->AssetSettings.bSavePackagesOnImport;
+	const bool bSkipUnchangedImportsCache = Settings->AssetSettings.bSkipUnchangedImports;
+	const bool bReimportChangedPropertiesOnlyCache = Settings->AssetSettings.bReimportChangedPropertiesOnly;
+
+	Settings->ExportDirectory.Path = ExportsDirectory;
+	Settings->AssetSettings.bSavePackagesOnImport = false;
+	Settings->AssetSettings.bSkipUnchangedImports = false;
+	Settings->AssetSettings.bReimportChangedPropertiesOnly = false;
+
+	/* Import ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	TMap<FString, FTypeResult> Results;
+	int32 Failed = 0;
+
+	FImportReport::BeginSession();
+
+	/* Exports are grouped by type in generation order */
+	for (int32 Start = 0; Start < Exports.Num();) {
+		const FString Type = Exports[Start].Type;
+
+		int32 End = Start;
+		while (End < Exports.Num() && Exports[End].Type == Type) End++;
+
+		FTypeResult& Result = Results.Add(Type);
+
+		FImportMemory::ResetPeakMemory();
+		const uint64 MemoryBefore = FImportMemory::GetUsedMemory();
+
+		const FImportTrace::FSnapshot Snapshot = FImportTrace::TakeSnapshot();
+		const double StartTime = FPlatformTime::Seconds();
+
+		/* Material compilation is part of the type's time */
+		FMaterialCompileBatch::Begin();
+
+		for (int32 Index = Start; Index < End; Index++) {
+			TArray<TSharedPtr<FJsonValue>> Json;
+
+			if (!DeserializeJSON(Exports[Index].File, Json)) {
+				Result.Failures.Add(FString::Printf(TEXT("%s: Unable to parse json"), *Exports[Index].ObjectPath));
+				continue;
+			}
+
+			try {
+				IImporter::ReadExportsAndImport(MoveTemp(Json), Exports[Index].File, true);
+			} catch (const char* Exception) {
+				Result.Failures.Add(FString::Printf(TEXT("%s: %s"), *Exports[Index].ObjectPath, *FString(Exception)));
+			}
+		}
+
+		FMaterialCompileBatch::End();
+
+		Result.Seconds = FPlatformTime::Seconds() - StartTime;
+		Result.Phases = FImportTrace::GetSecondsSince(Snapshot);
+		Result.PeakMemory = FImportMemory::GetPeakMemory() > MemoryBefore ? FImportMemory::GetPeakMemory() - MemoryBefore : 0;
+		Result.RetainedMemory = FImportMemory::GetUsedMemory() > MemoryBefore ? FImportMemory::GetUsedMemory() - MemoryBefore : 0;
+
+		/* Verified outside of the timed block */
+		for (int32 Index = Start; Index < End; Index++) {
+			int32 Elements = 0;
+			const FString Failure = VerifyAsset(Exports[Index], Elements);
+
+			Result.Assets++;
+			Result.Elements += Elements;
+
+			if (Failure.IsEmpty()) {
+				Result.Verified++;
+			} else {
+				Result.Failures.AddUnique(FString::Printf(TEXT("%s: %s"), *Exports[Index].ObjectPath, *Failure));
+			}
+		}
+
+		Failed += Result.Assets - Result.Verified;
+
+		UE_LOG(LogJsonAsAsset, Display, TEXT("Benchmark: %-14s %d/%d verified, %8.3f s, peak %7.1f MB, retained %7.1f MB"),
+			*Type, Result.Verified, Result.Assets, Result.Seconds, Result.PeakMemory / (1024.0 * 1024.0), Result.RetainedMemory / (1024.0 * 1024.0));
+
+		for (const FString& Failure : Result.Failures) {
+			UE_LOG(LogJsonAsAsset, Error, TEXT("Benchmark: %s"), *Failure);
+		}
+
+		Start = End;
+	}
+
+	const FString ReportPath = FImportReport::EndSession();
+
+	Settings->ExportDirectory.Path = ExportDirectoryCache;
+	Settings->AssetSettings.bSavePackagesOnImport = bSavePackagesOnImportCache;
+	Settings->AssetSettings.bSkipUnchangedImports = bSkipUnchangedImportsCache;
+	Settings->AssetSettings.bReimportChangedPropertiesOnly = bReimportChangedPropertiesOnlyCache;
+
+	/* Results ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	const TSharedRef<FJsonObject> ResultsObject = MakeShared<FJsonObject>(); {
+		ResultsObject->SetStringField(TEXT("Label"), Label);
+		ResultsObject->SetStringField(TEXT("Date"), FDateTime::Now().ToString());
+		ResultsObject->SetStringField(TEXT("EngineVersion"), FEngineVersion::Current().ToString());
+		ResultsObject->SetNumberField(TEXT("Seed"), Options.Seed);
+		ResultsObject->SetNumberField(TEXT("Scale"), Options.Scale);
+		ResultsObject->SetNumberField(TEXT("AssetsPerType"), Options.AssetsPerType);
+		ResultsObject->SetStringField(TEXT("Report"), ReportPath);
+	}
+
+	const TSharedRef<FJsonObject> TypesObject = MakeShared<FJsonObject>();
+
+	for (const TPair<FString, FTypeResult>& Pair : Results) {
+		const FTypeResult& Result = Pair.Value;
+
+		const TSharedRef<FJsonObject> Phases = MakeShared<FJsonObject>();
+		for (const TPair<FString, double>& Phase : Result.Phases) {
+			Phases->SetNumberField(Phase.Key, Phase.Value);
+		}
+
+		TArray<TSharedPtr<FJsonValue>> Failures;
+		for (const FString& Failure : Result.Failures) {
+			Failures.Add(MakeShared<FJsonValueString>(Failure));
+		}
+
+		const TSharedRef<FJsonObject> TypeObject = MakeShared<FJsonObject>(); {
+			TypeObject->SetNumberField(TEXT("Assets"), Result.Assets);
+			TypeObject->SetNumberField(TEXT("Verified"), Result.Verified);
+			TypeObject->SetNumberField(TEXT("Elements"), Result.Elements);
+			TypeObject->SetNumberField(TEXT("Seconds"), Result.Seconds);
+			TypeObject->SetNumberField(TEXT("PeakMemoryMB"), Result.PeakMemory / (1024.0 * 1024.0));
+			TypeObject->SetNumberField(TEXT("RetainedMemoryMB"), Result.RetainedMemory / (1024.0 * 1024.0));
+			TypeObject->SetObjectField(TEXT("Phases"), Phases);
+			TypeObject->SetArrayField(TEXT("Failures"), Failures);
+		}
+
+		TypesObject->SetObjectField(Pair.Key, TypeObject);
+	}
+
+	ResultsObject->SetObjectField(TEXT("Types"), TypesObject);
+
+	const FString ResultsPath = BenchmarkDirectory / FString::Printf(TEXT("Results_%s.json"), *Label);
+
+	FString Content;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
+	FJsonSerializer::Serialize(ResultsObject, Writer);
+
+	FFileHelper::SaveStringToFile(Content, *ResultsPath);
+
+	UE_LOG(LogJsonAsAsset, Display, TEXT("Benchmark: Results written to %s"), *ResultsPath);
+
+	int32 Regressions = 0;
+
+	if (const FString* Baseline = ParamsMap.Find(TEXT("Baseline"))) {
+		Regressions = CompareWithBaseline(*Baseline, Results, Threshold);
+	}
+
+	return Failed > 0 || Regressions > 0 ? 1 : 0;
+}
+
+FString UJsonAsAssetBenchmarkCommandlet::VerifyAsset(const FSyntheticExport& Export, int32& OutElements) {
+	OutElements = 0;
+
+	UObject* Object = FSoftObjectPath(Export.ObjectPath).TryLoad();
+
+	if (Object == nullptr) {
+		return TEXT("Asset was not created");
+	}
+
+	/* The components are subobjects of a label, every LOD of each has to keep its colors */
+	if (Export.Type == TEXT("StaticMeshComponent")) {
+		TArray<UObject*> Subobjects;
+		GetObjectsWithOuter(Object, Subobjects, false);
+
+		for (const UObject* Subobject : Subobjects) {
+			const UStaticMeshComponent* Component = Cast<UStaticMeshComponent>(Subobject);
+			if (Component == nullptr) continue;
+
+			for (const FStaticMeshComponentLODInfo& LODInfo : Component->LODData) {
+				if (LODInfo.OverrideVertexColors == nullptr) {
+					return FString::Printf(TEXT("%s has a LOD without vertex colors"), *Component->GetName());
+				}
+
+				OutElements += LODInfo.OverrideVertexColors->GetNumVertices();
+			}
+		}
+	} else if (const UDataTable* DataTable = Cast<UDataTable>(Object)) {
+		OutElements = DataTable->GetRowMap().Num();
+	} else if (const UCurveTable* CurveTable = Cast<UCurveTable>(Object)) {
+		OutElements = CurveTable->GetRowMap().Num();
+	} else if (const UUserDefinedStruct* Struct = Cast<UUserDefinedStruct>(Object)) {
+		for (TFieldIterator<FProperty> It(Struct); It; ++It) {
+			OutElements++;
+		}
+	} else if (const UMaterial* Material = Cast<UMaterial>(Object)) {
+#if ENGINE_UE5
+		OutElements = Material->GetExpressions().Num();
+#else
+		OutElements = Material->Expressions.Num();
+#endif
+	} else if (const USoundCue* SoundCue = Cast<USoundCue>(Object)) {
+		OutElements = SoundCue->AllNodes.Num();
+
+		if (SoundCue->FirstNode == nullptr) {
+			return TEXT("Sound cue has no first node");
+		}
+	} else if (const USkeleton* Skeleton = Cast<USkeleton>(Object)) {
+		OutElements = Skeleton->GetReferenceSkeleton().GetRawBoneNum();
+	} else if (const UPoseAsset* PoseAsset = Cast<UPoseAsset>(Object)) {
+		OutElements = PoseAsset->GetNumPoses();
+	} else if (const UPhysicsAsset* PhysicsAsset = Cast<UPhysicsAsset>(Object)) {
+		OutElements = PhysicsAsset->SkeletalBodySetups.Num();
+
+		if (PhysicsAsset->ConstraintSetup.Num() != OutElements - 1) {
+			return FString::Printf(TEXT("Expected %d constraints, found %d"), OutElements - 1, PhysicsAsset->ConstraintSetup.Num());
+		}
+
+		/* The body setup index map is only rebuilt once, at the end of the import */
+		if (OutElements > 0 && PhysicsAsset->FindBodyIndex(PhysicsAsset->SkeletalBodySetups.Last()->BoneName) != OutElements - 1) {
+			return TEXT("Body setup index map is out of date");
+		}
+	} else if (const UPrimaryAssetLabel* Label = Cast<UPrimaryAssetLabel>(Object)) {
+		OutElements = Label->ExplicitAssets.Num();
+	} else {
+		return FString::Printf(TEXT("Unexpected class %s"), *Object->GetClass()->GetName());
+	}
+
+	if (OutElements != Export.ExpectedElements) {
+		return FString::Printf(TEXT("Expected %d elements, found %d"), Export.ExpectedElements, OutElements);
+	}
+
+	return FString();
+}
+
+int32 UJsonAsAssetBenchmarkCommandlet::CompareWithBaseline(const FString& BaselinePath, const TMap<FString, FTypeResult>& Results, const double Threshold) {
+	TSharedPtr<FJsonObject> Baseline;
+	FString Content;
+
+	if (!FFileHelper::LoadFileToString(Content, *BaselinePath) || !DeserializeJSONObject(Content, Baseline) || !Baseline.IsValid()) {
+		UE_LOG(LogJsonAsAsset, Error, TEXT("Benchmark: Unable to read baseline %s"), *BaselinePath);
+		return 1;
+	}
+
+	const TSharedPtr<FJsonObject>* BaselineTypes;
+	if (!Baseline->TryGetObjectField(TEXT("Types"), BaselineTypes)) {
+		return 0;
+	}
+
+	UE_LOG(LogJsonAsAsset, Display, TEXT("Benchmark: Compared to %s (seed %d, scale %.2f)"),
+		*Baseline->GetStringField(TEXT("Label")), static_cast<int32>(Baseline->GetNumberField(TEXT("Seed"))), Baseline->GetNumberField(TEXT("Scale")));
+
+	int32 Regressions = 0;
+
+	for (const TPair<FString, FTypeResult>& Pair : Results) {
+		const TSharedPtr<FJsonObject>* BaselineType;
+		if (!(*BaselineTypes)->TryGetObjectField(Pair.Key, BaselineType)) continue;
+
+		const double BaselineSeconds = (*BaselineType)->GetNumberField(TEXT("Seconds"));
+		const double Seconds = Pair.Value.Seconds;
+
+		const bool bRegressed = Seconds > BaselineSeconds * (1.0 + Threshold) && Seconds - BaselineSeconds > GBenchmarkMinimumRegressionSeconds;
+		if (bRegressed) Regressions++;
+
+		UE_LOG(LogJsonAsAsset, Display, TEXT("Benchmark: %-14s %8.3f s -> %8.3f s (%+6.1f%%)%s"),
+			*Pair.Key, BaselineSeconds, Seconds, BaselineSeconds > 0.0 ? (Seconds / BaselineSeconds - 1.0) * 100.0 : 0.0, bRegressed ? TEXT(" REGRESSED") : TEXT(""));
+	}
+
+	return Regressions;
+}
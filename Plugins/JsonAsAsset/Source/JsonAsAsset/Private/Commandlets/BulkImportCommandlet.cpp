@@ -0,0 +1,352 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Commandlets/BulkImportCommandlet.h"
+
+#include "Importers/Constructor/Importer.h"
+#include "Settings/JsonAsAssetSettings.h"
+#include "Utilities/EngineUtilities.h"
+#include "Utilities/ImportMemory.h"
+#include "Utilities/ImportPreflight.h"
+#include "Utilities/ImportReport.h"
+#include "Utilities/ImportTrace.h"
+#include "Utilities/MaterialCompileBatch.h"
+#include "Modules/LogCategory.h"
+
+#include "Async/ParallelFor.h"
+#include "FileHelpers.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/SavePackage.h"
+
+/* How many imported files before the manifest is flushed to disk */
+static constexpr int32 GBulkImportManifestFlushInterval = 25;
+
+UJsonAsAssetBulkImportCommandlet::UJsonAsAssetBulkImportCommandlet() {
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UJsonAsAssetBulkImportCommandlet::Main(const FString& Params) {
+	TArray<FString> Tokens, Switches;
+	TMap<FString, FString> ParamsMap;
+	ParseCommandLine(*Params, Tokens, Switches, ParamsMap);
+
+	if (const FString* Root = ParamsMap.Find(TEXT("Root"))) {
+		RootPath = *Root;
+	}
+
+	if (RootPath.IsEmpty() || !FPaths::DirectoryExists(RootPath)) {
+		UE_LOG(LogJsonAsAsset, Error, TEXT("Bulk Import: -Root must point to an existing export directory (e.g. .../Output/Exports)"));
+		return 1;
+	}
+
+	RootPath = FPaths::ConvertRelativePathToFull(RootPath);
+	FPaths::NormalizeDirectoryName(RootPath);
+
+	TArray<FString> Includes, Excludes; {
+		if (const FString* Include = ParamsMap.Find(TEXT("Include"))) Include->ParseIntoArray(Includes, TEXT("+"));
+		if (const FString* Exclude = ParamsMap.Find(TEXT("Exclude"))) Exclude->ParseIntoArray(Excludes, TEXT("+"));
+	}
+
+	ManifestPath = FPaths::ProjectSavedDir() / TEXT("JsonAsAsset/BulkImportManifest.json");
+	if (const FString* Manifest = ParamsMap.Find(TEXT("Manifest"))) {
+		ManifestPath = *Manifest;
+	}
+
+	if (!Switches.Contains(TEXT("Fresh"))) {
+		LoadManifest();
+	}
+
+	/* Packages are created relative to the export directory, point it at the root for this run only */
+	UJsonAsAssetSettings* Settings = GetMutableDefault<UJsonAsAssetSettings>();
+	const FString ExportDirectoryCache = Settings->ExportDirectory.Path;
+	Settings->ExportDirectory.Path = RootPath;
+
+	/* Scan ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	TArray<FBulkImportFile> Files;
+	GatherFiles(RootPath, Includes, Excludes, Files);
+
+	UE_LOG(LogJsonAsAsset, Display, TEXT("Bulk Import: Found %d files (%d already completed)"), Files.Num(), CompletedFiles.Num());
+
+	if (Switches.Contains(TEXT("DryRun"))) {
+		TArray<FString> FullPaths;
+		for (const FBulkImportFile& File : Files) FullPaths.Add(File.FullPath);
+
+		const FImportPreflightReport Report = FImportPreflight::Analyze(FullPaths);
+		const FString ReportPath = FImportPreflight::SaveReport(Report);
+
+		UE_LOG(LogJsonAsAsset, Display, TEXT("Bulk Import: Preflight report (%s)\n%s"), *ReportPath, *Report.ToString());
+
+		Settings->ExportDirectory.Path = ExportDirectoryCache;
+
+		return 0;
+	}
+
+	ParseReferences(Files);
+	const TArray<int32> Order = SortByDependencies(Files);
+
+	/* Import ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	int32 Imported = 0, Failed = 0, Skipped = 0;
+
+	FImportMemory::ResetPeakMemory();
+	FImportReport::BeginSession();
+	FMaterialCompileBatch::Begin();
+
+	for (int32 Position = 0; Position < Order.Num(); Position++) {
+		const FBulkImportFile& File = Files[Order[Position]];
+
+		if (CompletedFiles.Contains(File.RelativePath)) {
+			Skipped++;
+			continue;
+		}
+
+		if (!File.bParsed) {
+			UE_LOG(LogJsonAsAsset, Warning, TEXT("Bulk Import: Skipping unreadable file %s"), *File.RelativePath);
+			FailedFiles.Add(File.RelativePath);
+			Failed++;
+			continue;
+		}
+
+		UE_LOG(LogJsonAsAsset, Display, TEXT("Bulk Import: [%d/%d] %s"), Position + 1, Order.Num(), *File.RelativePath);
+
+		if (ImportFile(File)) {
+			CompletedFiles.Add(File.RelativePath);
+			FailedFiles.Remove(File.RelativePath);
+			Imported++;
+		} else {
+			FailedFiles.Add(File.RelativePath);
+			Failed++;
+		}
+
+		if ((Imported + Failed) % GBulkImportManifestFlushInterval == 0) {
+			SaveManifest();
+		}
+
+		/* Everything this file created is saved, it can be unloaded if memory is tight */
+		FImportMemory::TrimBetweenFiles();
+	}
+
+	SaveManifest();
+	Settings->ExportDirectory.Path = ExportDirectoryCache;
+
+	/* Compiling updates instances' static permutations, save them again */
+	const double CompileSeconds = FMaterialCompileBatch::End();
+	SaveDirtyPackages();
+
+	const FString ReportPath = FImportReport::EndSession();
+
+	UE_LOG(LogJsonAsAsset, Display, TEXT("Bulk Import: Finished, %d imported, %d failed, %d skipped, material compilation %.2f s, peak memory %.1f MB (manifest: %s, report: %s)"),
+		Imported, Failed, Skipped, CompileSeconds, FImportMemory::GetPeakMemory() / (1024.0 * 1024.0), *ManifestPath, *ReportPath);
+
+	return Failed > 0 ? 1 : 0;
+}
+
+void UJsonAsAssetBulkImportCommandlet::GatherFiles(const FString& Root, const TArray<FString>& Includes, const TArray<FString>& Excludes, TArray<FBulkImportFile>& OutFiles) const {
+	TArray<FString> FoundFiles;
+	IFileManager::Get().FindFilesRecursive(FoundFiles, *Root, TEXT("*.json"), true, false);
+
+	/* Deterministic order, the file system doesn't guarantee one */
+	FoundFiles.Sort();
+
+	for (const FString& FullPath : FoundFiles) {
+		FString RelativePath = FullPath;
+		FPaths::MakePathRelativeTo(RelativePath, *(Root + TEXT("/")));
+
+		if (Includes.Num() > 0 && !Includes.ContainsByPredicate([&RelativePath](const FString& Pattern) { return RelativePath.MatchesWildcard(Pattern); })) {
+			continue;
+		}
+
+		if (Excludes.ContainsByPredicate([&RelativePath](const FString& Pattern) { return RelativePath.MatchesWildcard(Pattern); })) {
+			continue;
+		}
+
+		FBulkImportFile File; {
+			File.RelativePath = RelativePath;
+			File.FullPath = FullPath;
+			File.PackageKey = FImportPreflight::ToPackageKey(RelativePath);
+		}
+
+		OutFiles.Add(File);
+	}
+}
+
+/* Recursively collects every "ObjectPath" string inside a json value */
+static void CollectObjectPaths(const TSharedPtr<FJsonValue>& Value, TSet<FString>& OutPaths) {
+	if (!Value.IsValid()) return;
+
+	if (Value->Type == EJson::Array) {
+		for (const TSharedPtr<FJsonValue>& Element : Value->AsArray()) {
+			CollectObjectPaths(Element, OutPaths);
+		}
+
+		return;
+	}
+
+	if (Value->Type != EJson::Object) return;
+
+	for (const auto& Pair : Value->AsObject()->Values) {
+		if (Pair.Value.IsValid() && Pair.Value->Type == EJson::String && Pair.Key == TEXT("ObjectPath")) {
+			OutPaths.Add(Pair.Value->AsString());
+			continue;
+		}
+
+		CollectObjectPaths(Pair.Value, OutPaths);
+	}
+}
+
+void UJsonAsAssetBulkImportCommandlet::ParseReferences(TArray<FBulkImportFile>& Files) {
+	ParallelFor(Files.Num(), [&Files](const int32 Index) {
+		FBulkImportFile& File = Files[Index];
+
+		TArray<TSharedPtr<FJsonValue>> Exports;
+		if (!DeserializeJSON(File.FullPath, Exports)) return;
+
+		TSet<FString> ObjectPaths;
+		for (const TSharedPtr<FJsonValue>& Export : Exports) {
+			CollectObjectPaths(Export, ObjectPaths);
+		}
+
+		for (const FString& ObjectPath : ObjectPaths) {
+			FString Key = FImportPreflight::ToPackageKey(ObjectPath);
+
+			if (Key != File.PackageKey) {
+				File.References.AddUnique(MoveTemp(Key));
+			}
+		}
+
+		File.bParsed = true;
+	});
+}
+
+TArray<int32> UJsonAsAssetBulkImportCommandlet::SortByDependencies(const TArray<FBulkImportFile>& Files) {
+	TMap<FString, int32> FileByPackage; {
+		FileByPackage.Reserve(Files.Num());
+
+		for (int32 Index = 0; Index < Files.Num(); Index++) {
+			FileByPackage.Add(Files[Index].PackageKey, Index);
+		}
+	}
+
+	/* Edges go from a referenced file to the files that reference it */
+	TArray<TArray<int32>> Dependents;
+	TArray<int32> InDegree;
+	Dependents.SetNum(Files.Num());
+	InDegree.SetNumZeroed(Files.Num());
+
+	for (int32 Index = 0; Index < Files.Num(); Index++) {
+		for (const FString& Reference : Files[Index].References) {
+			if (const int32* Dependency = FileByPackage.Find(Reference)) {
+				Dependents[*Dependency].Add(Index);
+				InDegree[Index]++;
+			}
+		}
+	}
+
+	TArray<int32> Order;
+	Order.Reserve(Files.Num());
+
+	for (int32 Index = 0; Index < Files.Num(); Index++) {
+		if (InDegree[Index] == 0) Order.Add(Index);
+	}
+
+	for (int32 Head = 0; Head < Order.Num(); Head++) {
+		for (const int32 Dependent : Dependents[Order[Head]]) {
+			if (--InDegree[Dependent] == 0) {
+				Order.Add(Dependent);
+			}
+		}
+	}
+
+	/* Anything left is part of a cycle, import it last in its original order */
+	if (Order.Num() != Files.Num()) {
+		UE_LOG(LogJsonAsAsset, Warning, TEXT("Bulk Import: %d files are part of reference cycles"), Files.Num() - Order.Num());
+
+		for (int32 Index = 0; Index < Files.Num(); Index++) {
+			if (InDegree[Index] > 0) Order.Add(Index);
+		}
+	}
+
+	return Order;
+}
+
+bool UJsonAsAssetBulkImportCommandlet::ImportFile(const FBulkImportFile& File) {
+	TArray<TSharedPtr<FJsonValue>> Exports;
+	if (!DeserializeJSON(File.FullPath, Exports)) return false;
+
+	bool bSuccessful = false; {
+		try {
+			bSuccessful = IImporter::ReadExportsAndImport(MoveTemp(Exports), File.FullPath, true);
+		} catch (const char* Exception) {
+			UE_LOG(LogJsonAsAsset, Error, TEXT("Bulk Import: Importer exception: %s"), *FString(Exception));
+		}
+	}
+
+	/* Save everything this import touched */
+	SaveDirtyPackages();
+
+	return bSuccessful;
+}
+
+void UJsonAsAssetBulkImportCommandlet::SaveDirtyPackages() {
+	TArray<UPackage*> DirtyPackages;
+	FEditorFileUtils::GetDirtyContentPackages(DirtyPackages);
+
+	for (UPackage* Package : DirtyPackages) {
+		JSONASASSET_TRACE_SCOPE("SavePackage", SavePackages)
+
+		const FString PackageFileName = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+
+#if ENGINE_UE5
+		FSavePackageArgs SaveArgs; {
+			SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+			SaveArgs.Error = GError;
+			SaveArgs.SaveFlags = SAVE_NoError;
+		}
+
+		UPackage::SavePackage(Package, nullptr, *PackageFileName, SaveArgs);
+#else
+		UPackage::SavePackage(Package, nullptr, RF_Standalone, *PackageFileName);
+#endif
+	}
+}
+
+void UJsonAsAssetBulkImportCommandlet::LoadManifest() {
+	TSharedPtr<FJsonObject> Manifest;
+	FString Content;
+
+	if (!FFileHelper::LoadFileToString(Content, *ManifestPath) || !DeserializeJSONObject(Content, Manifest) || !Manifest.IsValid()) {
+		return;
+	}
+
+	/* A manifest only applies to the root it was written for */
+	if (Manifest->GetStringField(TEXT("Root")) != RootPath) {
+		UE_LOG(LogJsonAsAsset, Warning, TEXT("Bulk Import: Manifest was written for a different root, starting fresh"));
+		return;
+	}
+
+	for (const TSharedPtr<FJsonValue>& Value : Manifest->GetArrayField(TEXT("Completed"))) {
+		CompletedFiles.Add(Value->AsString());
+	}
+}
+
+void UJsonAsAssetBulkImportCommandlet::SaveManifest() const {
+	const TSharedPtr<FJsonObject> Manifest = MakeShared<FJsonObject>();
+	Manifest->SetStringField(TEXT("Root"), RootPath);
+
+	TArray<TSharedPtr<FJsonValue>> Completed, Failed; {
+		for (const FString& File : CompletedFiles) Completed.Add(MakeShared<FJsonValueString>(File));
+		for (const FString& File : FailedFiles) Failed.Add(MakeShared<FJsonValueString>(File));
+	}
+
+	Manifest->SetArrayField(TEXT("Completed"), Completed);
+	Manifest->SetArrayField(TEXT("Failed"), Failed);
+
+	FString Content;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
+	FJsonSerializer::Serialize(Manifest.ToSharedRef(), Writer);
+
+	FFileHelper::SaveStringToFile(Content, *ManifestPath);
+}
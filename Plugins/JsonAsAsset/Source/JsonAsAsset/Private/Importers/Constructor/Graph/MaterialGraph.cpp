@@ -19,15 +19,20 @@
 TSharedPtr<FJsonObject> IMaterialGraph::FindMaterialData(UObject* Parent, const FString& Type, const FString& Outer, FUObjectExportContainer& Container) {
 	TSharedPtr<FJsonObject> EditorOnlyData;
 
+	const FString EditorOnlyDataType = Type + "EditorOnlyData";
+	const FName OuterName(Outer);
+
+	Container.Exports.Reserve(Container.Exports.Num() + AllJsonObjects.Num());
+
 	/* Filter array if needed */
-	for (const TSharedPtr<FJsonValue> Value : AllJsonObjects) {
-		TSharedPtr<FJsonObject> Object = TSharedPtr<FJsonObject>(Value->AsObject());
+	for (const TSharedPtr<FJsonValue>& Value : AllJsonObjects) {
+		const TSharedPtr<FJsonObject> Object = Value->AsObject();
 
-		FString ExportType = Object->GetStringField(TEXT("Type"));
-		FName ExportName(Object->GetStringField(TEXT("Name")));
+		const FString ExportType = Object->GetStringField(TEXT("Type"));
+		const FName ExportName(Object->GetStringField(TEXT("Name")));
 
 		/* If an editor only data object is found, just set it */
-		if (ExportType == Type + "EditorOnlyData") {
+		if (ExportType == EditorOnlyDataType) {
 			EditorOnlyData = Object;
 			continue;
 		}
@@ -39,14 +44,14 @@ TSharedPtr<FJsonObject> IMaterialGraph::FindMaterialData(UObject* Parent, const
 		}
 
 		/* Add to the list of expressions */
-		Container.Exports.Add(FUObjectExport(
+		Container.Exports.Emplace(
 			ExportName,
 			FName(ExportType),
-			FName(Outer),
+			OuterName,
 			Object,
 			nullptr,
 			Parent
-		));
+		);
 	}
 
 	return EditorOnlyData->GetObjectField(TEXT("Properties"));
@@ -76,7 +81,11 @@ void IMaterialGraph::ConstructExpressions(FUObjectExportContainer& Container) {
 }
 
 void IMaterialGraph::PropagateExpressions(FUObjectExportContainer& Container) {
-	for (FUObjectExport Export : Container.Exports) {
+	/* Every expression exists by now, inputs link to them through the container's name index */
+	UPropertySerializer* PropertySerializer = GetObjectSerializer()->GetPropertySerializer();
+	TGuardValue<const FUObjectExportContainer*> LocalExportsGuard(PropertySerializer->LocalExports, &Container);
+
+	for (FUObjectExport& Export : Container.Exports) {
 		/* Get variables from the export data */
 		UObject* Parent = Export.Parent;
 
@@ -99,10 +108,9 @@ void IMaterialGraph::PropagateExpressions(FUObjectExportContainer& Container) {
 			TSharedPtr<FJsonObject> SubGraphExpressionObject = Properties->GetObjectField(TEXT("SubgraphExpression"));
 
 			FName SubGraphExpressionName = GetExportNameOfSubobject(SubGraphExpressionObject->GetStringField(TEXT("ObjectName")));
-			FUObjectExport SubGraphExport = Container.Find(SubGraphExpressionName);
 
 #if ENGINE_UE5
-			UMaterialExpression* SubGraphExpression = SubGraphExport.Get<UMaterialExpression>();
+			UMaterialExpression* SubGraphExpression = Container.Find<UMaterialExpression>(SubGraphExpressionName);
 
 			/* SubgraphExpression is only on Unreal Engine 5 */
 			Expression->SubgraphExpression = SubGraphExpression;
@@ -191,35 +199,38 @@ UMaterialExpression* IMaterialGraph::CreateEmptyExpression(FUObjectExport& Expor
 	const FName Type = Export.Type;
 	const FName Name = Export.Name;
 	
-#if UE5_6_BEYOND
-	const UClass* Class = FindFirstObject<UClass>(*Type.ToString());
-#else
-	const UClass* Class = FindObject<UClass>(ANY_PACKAGE, *Type.ToString());
-#endif
-	
 	/* Material/MaterialFunction Parent */
 	UObject* Parent = Export.Parent;
 
-	if (!Class) {
+	/* Looked up once per type and graph, the resolver caches redirect probes across graphs */
+	const UClass* const* CachedClass = ExpressionClasses.Find(Type);
+
+	const UClass* Class = CachedClass ? *CachedClass : FTypeResolver::ResolveClass("MaterialExpression:" + Type.ToString(), [&Type]() -> UClass* {
+		UClass* ResolvedClass = FTypeResolver::FindClass(Type.ToString());
+
 #if ENGINE_UE5
-		TArray<FString> Redirects = TArray {
-			FLinkerLoad::FindNewPathNameForClass("/Script/InterchangeImport." + Type.ToString(), false),
-			FLinkerLoad::FindNewPathNameForClass("/Script/Landscape." + Type.ToString(), false)
-		};
-		
-		for (FString RedirectedPath : Redirects) {
-			if (!RedirectedPath.IsEmpty() && !Class)
-				Class = FindObject<UClass>(nullptr, *RedirectedPath);
+		if (!ResolvedClass) {
+			TArray<FString> Redirects = TArray {
+				FLinkerLoad::FindNewPathNameForClass("/Script/InterchangeImport." + Type.ToString(), false),
+				FLinkerLoad::FindNewPathNameForClass("/Script/Landscape." + Type.ToString(), false)
+			};
+			
+			for (FString RedirectedPath : Redirects) {
+				if (!RedirectedPath.IsEmpty() && !ResolvedClass)
+					ResolvedClass = FTypeResolver::FindClassByPath(RedirectedPath);
+			}
 		}
 #endif
 
-		if (!Class) {
-#if UE5_6_BEYOND
-			Class = FindFirstObject<UClass>(*Type.ToString().Replace(TEXT("MaterialExpressionPhysicalMaterialOutput"), TEXT("MaterialExpressionLandscapePhysicalMaterialOutput")));
-#else
-			Class = FindObject<UClass>(ANY_PACKAGE, *Type.ToString().Replace(TEXT("MaterialExpressionPhysicalMaterialOutput"), TEXT("MaterialExpressionLandscapePhysicalMaterialOutput")));
-#endif
+		if (!ResolvedClass) {
+			ResolvedClass = FTypeResolver::FindClass(Type.ToString().Replace(TEXT("MaterialExpressionPhysicalMaterialOutput"), TEXT("MaterialExpressionLandscapePhysicalMaterialOutput")));
 		}
+
+		return ResolvedClass;
+	});
+
+	if (CachedClass == nullptr) {
+		ExpressionClasses.Add(Type, Class);
 	}
 
 	/* If a node is missing in the class, notify the user */
@@ -11,114 +11,75 @@
 #include "Sound/SoundCue.h"
 #include "Settings/JsonAsAssetSettings.h"
 
-void ISoundGraph::ConstructNodes(USoundCue* SoundCue, TArray<TSharedPtr<FJsonValue>> JsonArray, TMap<FString, USoundNode*>& OutNodes) {
-	for (const TSharedPtr<FJsonValue> JsonValue : JsonArray) {
+void ISoundGraph::ConstructNodes(USoundCue* SoundCue, const TArray<TSharedPtr<FJsonValue>>& JsonArray, FUObjectExportContainer& OutNodes) {
+	for (const TSharedPtr<FJsonValue>& JsonValue : JsonArray) {
 		const TSharedPtr<FJsonObject> CurrentNodeObject = JsonValue->AsObject();
 
 		if (!CurrentNodeObject->HasField(TEXT("Type"))) {
 			continue;
 		}
 		
-		FString NodeType = CurrentNodeObject->GetStringField(TEXT("Type"));
-		FString NodeName = CurrentNodeObject->GetStringField(TEXT("Name"));
+		const FString NodeType = CurrentNodeObject->GetStringField(TEXT("Type"));
+		const FString NodeName = CurrentNodeObject->GetStringField(TEXT("Name"));
 
 		/* Filter only exports with SoundNode at the start */
 		if (NodeType.StartsWith("SoundNode")) {
 			USoundNode* SoundCueNode = CreateEmptyNode(FName(*NodeName), FName(*NodeType), SoundCue);
 
-			OutNodes.Add(NodeName, SoundCueNode);
+			if (SoundCueNode == nullptr) {
+				continue;
+			}
+
+			OutNodes.Exports.Add(FUObjectExport(FName(*NodeName), FName(*NodeType), FName(*SoundCue->GetName()), CurrentNodeObject, SoundCueNode, SoundCue));
 		}
 	}
 }
 
-USoundNode* ISoundGraph::CreateEmptyNode(FName Name, const FName Type, USoundCue* SoundCue) {
-#if UE5_6_BEYOND
-	UClass* Class = FindFirstObject<UClass>(*Type.ToString());
-#else
-	UClass* Class = FindObject<UClass>(ANY_PACKAGE, *Type.ToString());
-#endif
-	/* TODO: Construct the sound node manually to have the exact same object name */
-	return SoundCue->ConstructSoundNode<USoundNode>(
-		Class,
-		false
-	);
-}
+USoundNode* ISoundGraph::CreateEmptyNode(const FName Name, const FName Type, USoundCue* SoundCue) {
+	UClass* Class = FTypeResolver::FindClass(Type.ToString());
 
-void ISoundGraph::SetupNodes(USoundCue* SoundCueAsset, TMap<FString, USoundNode*> SoundCueNodes, TArray<TSharedPtr<FJsonValue>> JsonObjectArray) const {
-	auto MainJsonObject = JsonObjectArray[0]->AsObject();
-	auto MainJsonObjectProperties = MainJsonObject->TryGetField(TEXT("Properties"))->AsObject();
+	if (Class == nullptr || !Class->IsChildOf(USoundNode::StaticClass())) {
+		return nullptr;
+	}
 
-	/* If Node is connected to Root Node */
-	if (MainJsonObjectProperties->HasField(TEXT("FirstNode"))) {
-		auto FirstNodeProp = MainJsonObjectProperties->TryGetField(TEXT("FirstNode"))->AsObject();
-		auto FirstNodeName = FirstNodeProp->TryGetField(TEXT("ObjectName"))->AsString();
+	/* Only the runtime node, its graph node is created once the whole tree is built */
+	USoundNode* SoundNode = NewObject<USoundNode>(SoundCue, Class, Name, RF_Transactional);
+	SoundCue->AllNodes.Add(SoundNode);
 
-		int32 ColonIndex = FirstNodeName.Find(TEXT(":"));
-		int32 QuoteIndex = FirstNodeName.Find(TEXT("'"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
-		FString ChildNodeName = FirstNodeName.Mid(ColonIndex + 1, QuoteIndex - ColonIndex - 1);
+	return SoundNode;
+}
 
-		USoundNode** FirstNode = SoundCueNodes.Find(ChildNodeName);
-		UEdGraphNode* RootNode = SoundCueAsset->SoundCueGraph->Nodes[0];
+void ISoundGraph::SetupNodes(USoundCue* SoundCue, FUObjectExportContainer& SoundCueNodes) const {
+	/* Root of the tree */
+	const TSharedPtr<FJsonObject>* FirstNodeObject;
 
-		/* Connect Node to Root Node */
-		if (FirstNode && RootNode) {
-			ConnectEdGraphNode((*FirstNode)->GetGraphNode(), RootNode, 0);
-		}
+	if (AssetData->TryGetObjectField(TEXT("FirstNode"), FirstNodeObject)) {
+		SoundCue->FirstNode = SoundCueNodes.Find<USoundNode>(GetExportNameOfSubobject((*FirstNodeObject)->GetStringField(TEXT("ObjectName"))));
 	}
 
-	/* Connections done here */
-	for (TSharedPtr<FJsonValue> JsonValue : JsonObjectArray) {
-		TSharedPtr<FJsonObject> CurrentNodeObject = JsonValue->AsObject();
+	/* Children and properties of every node, in one pass */
+	for (const FUObjectExport& NodeExport : SoundCueNodes.Exports) {
+		USoundNode* Node = NodeExport.Get<USoundNode>();
 
-		if (!CurrentNodeObject->HasField(TEXT("Type"))) {
-			continue;
-		}
-		
-		FString NodeType = CurrentNodeObject->GetStringField(TEXT("Type"));
-		FString NodeName = CurrentNodeObject->GetStringField(TEXT("Name"));
+		const TSharedPtr<FJsonObject>* NodePropertiesPtr;
 
-		/* Make sure it has Properties and it's a SoundNode */
-		if (!CurrentNodeObject->HasField(TEXT("Properties")) || !NodeType.StartsWith("SoundNode")) {
+		if (Node == nullptr || !NodeExport.JsonObject->TryGetObjectField(TEXT("Properties"), NodePropertiesPtr)) {
 			continue;
 		}
 
-		TSharedPtr<FJsonObject> NodeProperties = CurrentNodeObject->TryGetField(TEXT("Properties"))->AsObject();
+		const TSharedPtr<FJsonObject> NodeProperties = *NodePropertiesPtr;
+		const TArray<TSharedPtr<FJsonValue>>* ChildNodes;
 
-		USoundNode** CurrentNode = SoundCueNodes.Find(NodeName);
-		USoundNode* Node = *CurrentNode;
-		
-		/* Filter only node with ChildNodes and handle the pins */
-		if (NodeProperties->HasField(TEXT("ChildNodes"))) {
-			TArray<TSharedPtr<FJsonValue>> CurrentNodeChildNodes = NodeProperties->TryGetField(TEXT("ChildNodes"))->AsArray();
-
-			/* Save an index of the current connection */
-			int32 ConnectionIndex = 0;
+		if (NodeProperties->TryGetArrayField(TEXT("ChildNodes"), ChildNodes)) {
+			Node->ChildNodes.SetNum(ChildNodes->Num());
 
-			for (TSharedPtr<FJsonValue> CurrentNodeValue : CurrentNodeChildNodes) {
-				auto CurrentNodeChildNode = CurrentNodeValue->AsObject();
+			for (int32 ChildIndex = 0; ChildIndex < ChildNodes->Num(); ChildIndex++) {
+				const TSharedPtr<FJsonObject> ChildNodeObject = (*ChildNodes)[ChildIndex]->AsObject();
 
-				/* Insert a child node if it doesn't exist */
-				if (!Node->ChildNodes.IsValidIndex(ConnectionIndex)) {
-					Node->InsertChildNode(ConnectionIndex);
-				}
-
-				if (CurrentNodeChildNode->HasField(TEXT("ObjectName"))) {
-					auto CurrentChildNodeObjectName = CurrentNodeChildNode->TryGetField(TEXT("ObjectName"))->AsString();
-
-					int32 ColonIndex = CurrentChildNodeObjectName.Find(TEXT(":"));
-					int32 QuoteIndex = CurrentChildNodeObjectName.Find(TEXT("'"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
-					FString CurrentChildNodeName = CurrentChildNodeObjectName.Mid(ColonIndex + 1, QuoteIndex - ColonIndex - 1);
-
-					USoundNode** CurrentChildNode = SoundCueNodes.Find(CurrentChildNodeName);
-					int CurrentPin = ConnectionIndex + 1;
-
-					/* Connect it */
-					if (CurrentNode && CurrentChildNode) {
-						ConnectSoundNode(*CurrentChildNode, *CurrentNode, CurrentPin);
-					}
-				}
-				
-				ConnectionIndex++;
+				/* Empty inputs stay empty */
+				Node->ChildNodes[ChildIndex] = ChildNodeObject.IsValid() && ChildNodeObject->HasField(TEXT("ObjectName"))
+					? SoundCueNodes.Find<USoundNode>(GetExportNameOfSubobject(ChildNodeObject->GetStringField(TEXT("ObjectName"))))
+					: nullptr;
 			}
 		}
 
@@ -126,12 +87,10 @@ void ISoundGraph::SetupNodes(USoundCue* SoundCueAsset, TMap<FString, USoundNode*
 		GetObjectSerializer()->DeserializeObjectProperties(RemovePropertiesShared(NodeProperties, TArray<FString>
 		{
 			"ChildNodes"
-		}), *CurrentNode);
+		}), Node);
 
 		/* Import Sound Wave */
-		if (Cast<USoundNodeWavePlayer>(Node) != nullptr) {
-			auto WavePlayerNode = Cast<USoundNodeWavePlayer>(Node);
-
+		if (USoundNodeWavePlayer* WavePlayerNode = Cast<USoundNodeWavePlayer>(Node)) {
 			if (NodeProperties->HasField(TEXT("SoundWaveAssetPtr"))) {
 				FString AssetPtr = NodeProperties->TryGetField(TEXT("SoundWaveAssetPtr"))->AsObject()->GetStringField(TEXT("AssetPathName"));
 
@@ -155,15 +114,16 @@ void ISoundGraph::SetupNodes(USoundCue* SoundCueAsset, TMap<FString, USoundNode*
 	}
 }
 
-void ISoundGraph::ConnectEdGraphNode(UEdGraphNode* NodeToConnect, UEdGraphNode* NodeToConnectTo, int Pin = 1) {
-	NodeToConnect->Pins[0]->MakeLinkTo(NodeToConnectTo->Pins[Pin]);
-}
-
-void ISoundGraph::ConnectSoundNode(const USoundNode* NodeToConnect, const USoundNode* NodeToConnectTo, int Pin = 1) {
-	if (NodeToConnectTo->GetGraphNode()->Pins.IsValidIndex(Pin))
-	{
-		NodeToConnect->GetGraphNode()->Pins[0]->MakeLinkTo(NodeToConnectTo->GetGraphNode()->Pins[Pin]);
+void ISoundGraph::CreateGraphFromNodes(USoundCue* SoundCue) {
+	/* Graph nodes allocate one input pin per child, so the tree has to be finished first */
+	for (USoundNode* SoundNode : SoundCue->AllNodes) {
+		if (SoundNode != nullptr && SoundNode->GetGraphNode() == nullptr) {
+			SoundCue->SetupSoundNode(SoundNode, false);
+		}
 	}
+
+	/* Links every pin (and the root) from the node tree, notifying the graph once */
+	SoundCue->LinkGraphNodesFromSoundNodes();
 }
 
 void ISoundGraph::ImportSoundWave(const FString& URL, FString SavePath, FString AssetPtr, USoundNodeWavePlayer* Node) const {
@@ -10,6 +10,12 @@
 
 /* Utilities */
 #include "Utilities/AssetUtilities.h"
+#include "Utilities/ImportArena.h"
+#include "Utilities/ImportHashCache.h"
+#include "Utilities/ImportMemory.h"
+#include "Utilities/ImportReport.h"
+#include "Utilities/ImportTrace.h"
+#include "Utilities/MaterialCompileBatch.h"
 
 #include "Misc/MessageDialog.h"
 #include "UObject/SavePackage.h"
@@ -141,151 +147,385 @@ TMap<FString, TArray<FString>> ImporterTemplatedTypes = {
 	}
 };
 
+/*
+ * Groups exports into windows by the top level export their outer chain ends at,
+ * an asset's window holds the asset and all of its subobjects.
+ * Windows are in the order their first export (the top level one or any subobject) appears in the file.
+ */
+static TArray<TArray<int32>> GroupExportsByOuter(const TArray<TSharedPtr<FJsonValue>>& Exports) {
+	TMap<FString, int32> ExportsByName;
+	TArray<FString> Outers;
+	Outers.SetNum(Exports.Num());
+
+	for (int32 Index = 0; Index < Exports.Num(); Index++) {
+		const TSharedPtr<FJsonObject> Export = Exports[Index]->AsObject();
+		if (!Export.IsValid()) continue;
+
+		ExportsByName.FindOrAdd(Export->GetStringField(TEXT("Name")), Index);
+		Export->TryGetStringField(TEXT("Outer"), Outers[Index]);
+	}
+
+	TArray<TArray<int32>> Windows;
+	TMap<int32, int32> WindowByRoot;
+
+	for (int32 Index = 0; Index < Exports.Num(); Index++) {
+		int32 Root = Index;
+
+		/* Follow the outer chain, bounded in case of broken or circular outers */
+		for (int32 Depth = 0; Depth < 64 && !Outers[Root].IsEmpty(); Depth++) {
+			const int32* Outer = ExportsByName.Find(Outers[Root]);
+			if (Outer == nullptr || *Outer == Root) break;
+
+			Root = *Outer;
+		}
+
+		if (const int32* Window = WindowByRoot.Find(Root)) {
+			Windows[*Window].Add(Index);
+		} else {
+			WindowByRoot.Add(Root, Windows.Num());
+			Windows.Add({ Index });
+		}
+	}
+
+	/* The top level export leads its window */
+	for (const TPair<int32, int32>& Pair : WindowByRoot) {
+		TArray<int32>& Window = Windows[Pair.Value];
+		Window.Remove(Pair.Key);
+		Window.Insert(Pair.Key, 0);
+	}
+
+	return Windows;
+}
+
 bool IImporter::ReadExportsAndImport(TArray<TSharedPtr<FJsonValue>> Exports, FString File, const bool bHideNotifications) {
-	for (const TSharedPtr<FJsonValue>& ExportPtr : Exports) {
-		TSharedPtr<FJsonObject> DataObject = ExportPtr->AsObject();
+	FExportsImport ExportsImport(MoveTemp(Exports), File, bHideNotifications);
+
+	while (ExportsImport.ImportNext()) {}
 
-		FString Type = DataObject->GetStringField(TEXT("Type"));
-		FString Name = DataObject->GetStringField(TEXT("Name"));
+	return ExportsImport.WasSuccessful();
+}
+
+FExportsImport::FExportsImport(TArray<TSharedPtr<FJsonValue>> InExports, const FString& InFile, const bool bInHideNotifications)
+	: Exports(MoveTemp(InExports)), File(InFile), bHideNotifications(bInHideNotifications)
+{
+	FImportReport::RecordFile();
 
-		/* BlueprintGeneratedClass is post-fixed with _C */
-		if (Type.Contains("BlueprintGeneratedClass")) {
-			Name.Split("_C", &Name, nullptr, ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+	ImportOrder.Reserve(Exports.Num());
+
+	/* Without a memory budget nothing is released, exports are imported in file order */
+	if (GetDefault<UJsonAsAssetSettings>()->AssetSettings.ImportMemoryBudgetMB <= 0) {
+		for (int32 ExportIndex = 0; ExportIndex < Exports.Num(); ExportIndex++) {
+			ImportOrder.Add(ExportIndex);
 		}
-#if UE5_6_BEYOND
-		UClass* Class = FindFirstObject<UClass>(*Type);
-#else
-		UClass* Class = FindObject<UClass>(ANY_PACKAGE, *Type);
-#endif
-		
-		if (Class == nullptr) continue;
+	} else {
+		Windows = GroupExportsByOuter(Exports);
+		WindowOfExport.SetNum(Exports.Num());
+
+		for (int32 WindowIndex = 0; WindowIndex < Windows.Num(); WindowIndex++) {
+			for (const int32 ExportIndex : Windows[WindowIndex]) {
+				WindowOfExport[ExportIndex] = WindowIndex;
+				ImportOrder.Add(ExportIndex);
+			}
+		}
+	}
+
+	LiveExports = Exports;
+}
+
+bool FExportsImport::ImportNext() {
+	if (!bDone && NextExport < ImportOrder.Num()) {
+		ImportExport(ImportOrder[NextExport++]);
+	}
+
+	bDone |= NextExport >= ImportOrder.Num();
+
+	return !bDone;
+}
+
+void FExportsImport::ImportExport(const int32 ExportIndex) {
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("JsonAsAsset::ImportExport", JsonAsAssetChannel);
+
+	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
 
-		/* Check if this export can be imported */
-		const bool InheritsDataAsset = Class->IsChildOf(UDataAsset::StaticClass());
-		if (!CanImport(Type, false, Class)) continue;
+	const TSharedPtr<FJsonValue> ExportPtr = Exports[ExportIndex];
+	if (!ExportPtr.IsValid()) return;
 
-		/* Convert from relative path to full path */
-		if (FPaths::IsRelative(File)) File = FPaths::ConvertRelativePathToFull(File);
+	TSharedPtr<FJsonObject> DataObject = ExportPtr->AsObject();
 
-		RedirectPath(File);
+	FString Type = DataObject->GetStringField(TEXT("Type"));
+	FString Name = DataObject->GetStringField(TEXT("Name"));
 
-		FString FailureReason;
-		UPackage* LocalOutermostPkg;
-		UPackage* LocalPackage = FAssetUtilities::CreateAssetPackage(Name, File, LocalOutermostPkg, FailureReason);
+	/* BlueprintGeneratedClass is post-fixed with _C */
+	if (Type.Contains("BlueprintGeneratedClass")) {
+		Name.Split("_C", &Name, nullptr, ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+	}
+
+	UClass* Class = FTypeResolver::FindClass(Type);
+	
+	if (Class == nullptr) return;
+
+	/* Check if this export can be imported */
+	const bool InheritsDataAsset = Class->IsChildOf(UDataAsset::StaticClass());
+	if (!IImporter::CanImport(Type, false, Class)) return;
+
+	/* Convert from relative path to full path */
+	if (FPaths::IsRelative(File)) File = FPaths::ConvertRelativePathToFull(File);
+
+	RedirectPath(File);
+
+	const double AssetStartTime = FPlatformTime::Seconds();
+	const FImportTrace::FSnapshot AssetTraceSnapshot = FImportTrace::TakeSnapshot();
+
+	FString FailureReason;
+	UPackage* LocalOutermostPkg;
+	UPackage* LocalPackage = FAssetUtilities::CreateAssetPackage(Name, File, LocalOutermostPkg, FailureReason);
+
+	/* Adds the outcome of this export to the session's report */
+	auto ReportAsset = [&](const EImportReportStatus Status, const FString& Reason) {
+		FImportReportEntry Entry; {
+			Entry.Name = Name;
+			Entry.Type = Type;
+			Entry.Package = LocalPackage != nullptr ? LocalPackage->GetName() : FString();
+			Entry.File = File;
+			Entry.Status = Status;
+			Entry.Reason = Reason;
+			Entry.Seconds = FPlatformTime::Seconds() - AssetStartTime;
+			Entry.Phases = FImportTrace::GetSecondsSince(AssetTraceSnapshot);
+		}
+
+		FImportReport::RecordAsset(Entry);
+	};
 
-		if (LocalPackage == nullptr) {
-			/* Try fixing our Export Directory Settings using the provided File directory if local package not found */
+	if (LocalPackage == nullptr) {
+		/* Try fixing our Export Directory Settings using the provided File directory if local package not found */
             UJsonAsAssetSettings* PluginSettings = GetMutableDefault<UJsonAsAssetSettings>();
 
-			FString ExportDirectoryCache = PluginSettings->ExportDirectory.Path;
-			
-			if (FString DirectoryPathFix; File.Split(TEXT("Output/Exports/"), &DirectoryPathFix, nullptr, ESearchCase::IgnoreCase, ESearchDir::FromEnd)) {
-				DirectoryPathFix = DirectoryPathFix + TEXT("Output/Exports");
+		FString ExportDirectoryCache = PluginSettings->ExportDirectory.Path;
+		
+		if (FString DirectoryPathFix; File.Split(TEXT("Output/Exports/"), &DirectoryPathFix, nullptr, ESearchCase::IgnoreCase, ESearchDir::FromEnd)) {
+			DirectoryPathFix = DirectoryPathFix + TEXT("Output/Exports");
 
-				PluginSettings->ExportDirectory.Path = DirectoryPathFix;
-				SavePluginConfig(PluginSettings);
+			PluginSettings->ExportDirectory.Path = DirectoryPathFix;
+			SavePluginConfig(PluginSettings);
 
-				/* Retry creating the asset package */
-				LocalPackage = FAssetUtilities::CreateAssetPackage(Name, File, LocalOutermostPkg, FailureReason);
+			/* Retry creating the asset package */
+			LocalPackage = FAssetUtilities::CreateAssetPackage(Name, File, LocalOutermostPkg, FailureReason);
 
-				/* Undo the change if unsuccessful */
-				if (LocalPackage == nullptr) {
-					PluginSettings->ExportDirectory.Path = ExportDirectoryCache;
+			/* Undo the change if unsuccessful */
+			if (LocalPackage == nullptr) {
+				PluginSettings->ExportDirectory.Path = ExportDirectoryCache;
 
-					SavePluginConfig(PluginSettings);
-				}
+				SavePluginConfig(PluginSettings);
 			}
 		}
+	}
 
-		if (LocalPackage == nullptr) {
+	if (LocalPackage == nullptr) {
+		ReportAsset(EImportReportStatus::Failed, FailureReason);
+
+		if (!FImportReport::IsSessionActive()) {
 			AppendNotification(
 				FText::FromString("Import Failed: " + Type),
 				FText::FromString(FailureReason),
 				4.0f,
-				FSlateIconFinder::FindCustomIconBrushForClass(FindObject<UClass>(nullptr, *("/Script/Engine." + Type)), TEXT("ClassThumbnail")),
+				FTypeResolver::FindIcon(Type),
 				SNotificationItem::CS_Fail,
 				false,
 				350.0f
 			);
-
-			return false;
 		}
 
-		/* Importer ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-		IImporter* Importer = nullptr;
-		
-		/* Try to find the importer using a factory delegate */
-		if (const FImporterFactoryDelegate* Factory = FindFactoryForAssetType(Type)) {
-			Importer = (*Factory)(Name, File, DataObject, LocalPackage, LocalOutermostPkg, Exports, Class);
-		}
+		Stop(false);
+		return;
+	}
 
-		/* If it inherits DataAsset, use the data asset importer */
-		if (Importer == nullptr && InheritsDataAsset) {
-			Importer = new IDataAssetImporter(Name, File, DataObject, LocalPackage, LocalOutermostPkg, Exports, Class);
-		}
+	/* Skip exports that haven't changed since their last import, as long as the asset still exists */
+	const FString PackageName = LocalPackage->GetName();
 
-		/* By default, (with no existing importer) use the templated importer with the asset class. */
-		if (Importer == nullptr) {
-			Importer = new ITemplatedImporter<UObject>(
-				Name, File, DataObject, LocalPackage, LocalOutermostPkg, Exports, Class
-			);
+	/* Delta reimports use it too, for assets that are rebuilt rather than patched (see IImporter::IsUnchangedSinceLastImport) */
+	if (ExportsHash.IsEmpty() && (Settings->AssetSettings.bSkipUnchangedImports || Settings->AssetSettings.bReimportChangedPropertiesOnly)) {
+		ExportsHash = FImportHashCache::ComputeHash(Exports);
+	}
+
+	if (Settings->AssetSettings.bSkipUnchangedImports) {
+		if (FImportHashCache::IsUpToDate(PackageName, ExportsHash) && StaticFindObjectFast(nullptr, LocalPackage, FName(*Name)) != nullptr) {
+			UE_LOG(LogJsonAsAsset, Log, TEXT("Skipped \"%s\" as \"%s\", unchanged since last import"), *Name, *Type);
+
+			ReportAsset(EImportReportStatus::Skipped, FString());
+
+			if (bHideNotifications) {
+				Stop(true);
+				return;
+			}
+
+			GetMessageLog().Message(EMessageSeverity::Info, FText::FromString("Skipped Unchanged Asset: " + Name + " (" + Type + ")"));
+
+			return;
 		}
+	}
 
-		/* TODO: Don't hardcode this. */
-		if (IsAssetTypeImportableUsingCloud(Type)) {
-			Importer = new ITextureImporter<UTextureLightProfile>(
-				Name, File, DataObject, LocalPackage, LocalOutermostPkg, Exports, Class
-			);
+	if (!bPrefetchedReferences) {
+		FReferenceResolver::PrefetchReferences(Exports);
+		bPrefetchedReferences = true;
+	}
+
+	if (bReleasedWindow) {
+		LiveExports.Reset();
+
+		for (const TSharedPtr<FJsonValue>& Export : Exports) {
+			if (Export.IsValid()) LiveExports.Add(Export);
 		}
 
-		/* Import the asset ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-		bool Successful = false; {
-			try {
-				Successful = Importer->Import();
-			} catch (const char* Exception) {
-				UE_LOG(LogJsonAsAsset, Error, TEXT("Importer exception: %s"), *FString(Exception));
-			}
+		bReleasedWindow = false;
+	}
+
+	/* Importer ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	IImporter* Importer = nullptr;
+	
+	/* Try to find the importer using a factory delegate */
+	if (const IImporter::FImporterFactoryDelegate* Factory = IImporter::FindFactoryForAssetType(Type)) {
+		Importer = (*Factory)(Name, File, DataObject, LocalPackage, LocalOutermostPkg, LiveExports, Class);
+	}
+
+	/* If it inherits DataAsset, use the data asset importer */
+	if (Importer == nullptr && InheritsDataAsset) {
+		Importer = new IDataAssetImporter(Name, File, DataObject, LocalPackage, LocalOutermostPkg, LiveExports, Class);
+	}
+
+	/* By default, (with no existing importer) use the templated importer with the asset class. */
+	if (Importer == nullptr) {
+		Importer = new ITemplatedImporter<UObject>(
+			Name, File, DataObject, LocalPackage, LocalOutermostPkg, LiveExports, Class
+		);
+	}
+
+	/* TODO: Don't hardcode this. */
+	if (IImporter::IsAssetTypeImportableUsingCloud(Type)) {
+		Importer = new ITextureImporter<UTextureLightProfile>(
+			Name, File, DataObject, LocalPackage, LocalOutermostPkg, LiveExports, Class
+		);
+	}
+
+	Importer->ExportsHash = ExportsHash;
+
+	/* Import the asset ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	FString ImportFailure;
+
+	bool Successful = false; {
+		JSONASASSET_TRACE_SCOPE("Import", Import)
+#if ENGINE_UE5
+		TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(*Type, JsonAsAssetChannel);
+#endif
+
+		try {
+			Successful = Importer->Import();
+		} catch (const char* Exception) {
+			ImportFailure = FString(Exception);
+
+			UE_LOG(LogJsonAsAsset, Error, TEXT("Importer exception: %s"), *ImportFailure);
 		}
+	}
+
+	if (Successful && !ExportsHash.IsEmpty()) {
+		FImportHashCache::Record(PackageName, ExportsHash);
+	}
+
+	/* A new struct, enum or blueprint class may be what an earlier lookup failed to find */
+	if (Successful && (Class->IsChildOf(UStruct::StaticClass()) || Class->IsChildOf(UEnum::StaticClass()))) {
+		FTypeResolver::InvalidateMisses();
+	}
+
+	/* A failed import may have left the asset half written, never skip the next attempt */
+	if (!Successful) {
+		FImportHashCache::Invalidate(PackageName);
+	}
 
-		if (bHideNotifications) {
-			return Successful;
+	/* The asset holds everything now, the importer doesn't need its json anymore */
+	Importer->ReleaseJsonData();
+
+	/* Over budget, release the json of this asset's window for the rest of the file (no windows if the budget was set part way through) */
+	if (Successful && Windows.Num() > 0 && FImportMemory::IsOverBudget()) {
+		for (const int32 WindowExport : Windows[WindowOfExport[ExportIndex]]) {
+			Exports[WindowExport].Reset();
 		}
 
-		if (Successful) {
-			UE_LOG(LogJsonAsAsset, Log, TEXT("Successfully imported \"%s\" as \"%s\""), *Name, *Type);
+		DataObject.Reset();
+		bReleasedWindow = true;
+	}
 
-			/* TODO: Remove this? */
-			if (Type != "AnimSequence" && Type != "AnimMontage") {
-				Importer->SavePackage();
-			}
+	/* A delta reimport that changed nothing isn't saved, dirtied or announced */
+	const bool bUnchanged = Successful && Importer->IsAssetUnchanged();
+
+	if (bHideNotifications) {
+		ReportAsset(bUnchanged ? EImportReportStatus::Skipped : Successful ? EImportReportStatus::Imported : EImportReportStatus::Failed, ImportFailure);
+
+		Stop(Successful);
+		return;
+	}
+
+	if (bUnchanged) {
+		UE_LOG(LogJsonAsAsset, Log, TEXT("Reimported \"%s\" as \"%s\", no properties changed"), *Name, *Type);
+
+		ReportAsset(EImportReportStatus::Skipped, FString());
+
+		GetMessageLog().Message(EMessageSeverity::Info, FText::FromString("Unchanged Asset: " + Name + " (" + Type + ")"));
+	} else if (Successful) {
+		UE_LOG(LogJsonAsAsset, Log, TEXT("Successfully imported \"%s\" as \"%s\""), *Name, *Type);
 
-			/* Import Successful Notification */
+		/* TODO: Remove this? */
+		if (Type != "AnimSequence" && Type != "AnimMontage") {
+			Importer->SavePackage();
+		}
+
+		ReportAsset(EImportReportStatus::Imported, FString());
+
+		/* Import Successful Notification, sessions show one aggregated notification instead */
+		if (!FImportReport::IsSessionActive()) {
 			AppendNotification(
 				FText::FromString("Imported: " + Name),
 				FText::FromString(Type),
 				2.0f,
-				FSlateIconFinder::FindCustomIconBrushForClass(FindObject<UClass>(nullptr, *("/Script/Engine." + Type)), TEXT("ClassThumbnail")),
+				FTypeResolver::FindIcon(Type),
 				SNotificationItem::CS_Success,
 				false,
 				350.0f
 			);
+		}
 
-			GetMessageLog().Message(EMessageSeverity::Info, FText::FromString("Imported Asset: " + Name + " (" + Type + ")"));
-		} else {
-			/* Import Failed Notification */
+		GetMessageLog().Message(EMessageSeverity::Info, FText::FromString("Imported Asset: " + Name + " (" + Type + ")"));
+	} else {
+		ReportAsset(EImportReportStatus::Failed, ImportFailure);
+
+		/* Import Failed Notification */
+		if (!FImportReport::IsSessionActive()) {
 			AppendNotification(
 				FText::FromString("Import Failed: " + Name),
 				FText::FromString(Type),
 				2.0f,
-				FSlateIconFinder::FindCustomIconBrushForClass(FindObject<UClass>(nullptr, *("/Script/Engine." + Type)), TEXT("ClassThumbnail")),
+				FTypeResolver::FindIcon(Type),
 				SNotificationItem::CS_Fail,
 				false,
 				350.0f
 			);
 		}
+
+		GetMessageLog().Message(EMessageSeverity::Error, FText::FromString("Import Failed: " + Name + " (" + Type + ")"));
 	}
+}
 
-	return true;
+void IImporter::ReleaseJsonData() {
+	AllJsonObjects.Empty();
+	JsonObject.Reset();
+	AssetData.Reset();
+
+	if (PropertySerializer) {
+		PropertySerializer->ExportsContainer.Exports.Empty();
+		PropertySerializer->ClearCachedData();
+	}
+
+	if (GObjectSerializer) {
+		GObjectSerializer->Exports.Empty();
+	}
 }
 
 TArray<TSharedPtr<FJsonValue>> IImporter::GetObjectsWithPropertyNameStartingWith(const FString& StartsWithStr, const FString& PropertyName) {
@@ -336,17 +576,28 @@ bool IImporter::HandleAssetCreation(UObject* Asset) const {
 	if (!Asset->MarkPackageDirty()) return false;
 	
 	Package->SetDirtyFlag(true);
-	Asset->PostEditChange();
+
+	/* Materials compile once at the end of a batch instead */
+	const bool bDeferCompile = FMaterialCompileBatch::Defer(Asset);
+
+	if (!bDeferCompile) {
+		Asset->PostEditChange();
+	}
+
 	Asset->AddToRoot();
 	
 	Package->FullyLoad();
 
 	/* Browse to newly added Asset in the Content Browser */
-	const TArray<FAssetData>& Assets = { Asset };
-	const FContentBrowserModule& ContentBrowserModule = FModuleManager::Get().LoadModuleChecked<FContentBrowserModule>("ContentBrowser");
-	ContentBrowserModule.Get().SyncBrowserToAssets(Assets);
+	if (!IsRunningCommandlet()) {
+		const TArray<FAssetData>& Assets = { Asset };
+		const FContentBrowserModule& ContentBrowserModule = FModuleManager::Get().LoadModuleChecked<FContentBrowserModule>("ContentBrowser");
+		ContentBrowserModule.Get().SyncBrowserToAssets(Assets);
+	}
 
-	Asset->PostLoad();
+	if (!bDeferCompile) {
+		Asset->PostLoad();
+	}
 	
 	return true;
 }
@@ -363,6 +614,8 @@ template void IImporter::LoadObject<USoundNode>(const TSharedPtr<FJsonObject>*,
 
 template <typename T>
 void IImporter::LoadObject(const TSharedPtr<FJsonObject>* PackageIndex, TObjectPtr<T>& Object) {
+	JSONASASSET_TRACE_SCOPE("LoadObject", LoadReferences)
+
 	FString ObjectType, ObjectName, ObjectPath, Outer;
 	PackageIndex->Get()->GetStringField(TEXT("ObjectName")).Split("'", &ObjectType, &ObjectName);
 
@@ -417,6 +670,10 @@ void IImporter::LoadObject(const TSharedPtr<FJsonObject>* PackageIndex, TObjectP
 	if (!Object) {
 		Object = DownloadWrapper(LoadedObject, ObjectType, ObjectName, ObjectPath);
 	}
+
+	if (!Object) {
+		FImportReport::RecordUnresolvedReference(ObjectType + "'" + ObjectPath + "." + ObjectName + "'");
+	}
 }
 
 template TArray<TObjectPtr<UCurveLinearColor>> IImporter::LoadObject<UCurveLinearColor>(const TArray<TSharedPtr<FJsonValue>>&, TArray<TObjectPtr<UCurveLinearColor>>);
@@ -442,23 +699,50 @@ TArray<TObjectPtr<T>> IImporter::LoadObject(const TArray<TSharedPtr<FJsonValue>>
 }
 
 void IImporter::ImportReference(const FString& File) {
+	if (const TUniquePtr<FExportsImport> ExportsImport = BeginImportReference(File)) {
+		while (ExportsImport->ImportNext()) {}
+	}
+}
+
+TUniquePtr<FExportsImport> IImporter::BeginImportReference(const FString& File) {
+	TArray<TSharedPtr<FJsonValue>> DataObjects;
+
 	/* ~~~~  Parse JSON into UE JSON Reader ~~~~ */
-	FString ContentBefore;
-	FFileHelper::LoadFileToString(ContentBefore, *File);
+	bool bParsed = false; {
+		JSONASASSET_TRACE_SCOPE("ParseJson", ParseJson)
+
+		FString ContentBefore;
+		FFileHelper::LoadFileToString(ContentBefore, *File);
 
-	FString Content = FString(TEXT("{\"data\": "));
-	Content.Append(ContentBefore);
-	Content.Append(FString("}"));
+		FString Content = FString(TEXT("{\"data\": "));
+		Content.Append(ContentBefore);
+		Content.Append(FString("}"));
 
-	TSharedPtr<FJsonObject> JsonParsed;
-	const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(Content);
+		TSharedPtr<FJsonObject> JsonParsed;
+		const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(Content);
+
+		if (FJsonSerializer::Deserialize(JsonReader, JsonParsed)) {
+			DataObjects = JsonParsed->GetArrayField(TEXT("data"));
+			bParsed = true;
+		}
+	}
 	/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
-	if (FJsonSerializer::Deserialize(JsonReader, JsonParsed)) {
-		const TArray<TSharedPtr<FJsonValue>> DataObjects = JsonParsed->GetArrayField(TEXT("data"));
+	/* Only the importer holds on to the exports, so they can be released while importing */
+	if (bParsed) {
+		return MakeUnique<FExportsImport>(MoveTemp(DataObjects), File);
+	}
 
-		ReadExportsAndImport(DataObjects, File);
+	FImportReportEntry Entry; {
+		Entry.Name = FPaths::GetBaseFilename(File);
+		Entry.File = File;
+		Entry.Status = EImportReportStatus::Failed;
+		Entry.Reason = TEXT("Unable to parse json");
 	}
+
+	FImportReport::RecordAsset(Entry);
+
+	return nullptr;
 }
 
 TMap<FName, FExportData> IImporter::CreateExports() {
@@ -482,15 +766,21 @@ TMap<FName, FExportData> IImporter::CreateExports() {
 }
 
 void IImporter::SavePackage() const {
+	SavePackage(Package);
+}
+
+void IImporter::SavePackage(UPackage* InPackage) {
+	JSONASASSET_TRACE_SCOPE("SavePackage", SavePackages)
+
 	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
 
 	/* Ensure the package is valid before proceeding */
-	if (Package == nullptr) {
+	if (InPackage == nullptr) {
 		UE_LOG(LogJsonAsAsset, Error, TEXT("Package is null"));
 		return;
 	}
 
-	const FString PackageName = Package->GetName();
+	const FString PackageName = InPackage->GetName();
 	const FString PackageFileName = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
 
 	/* User option to save packages on import */
@@ -502,10 +792,14 @@ void IImporter::SavePackage() const {
 			SaveArgs.SaveFlags = SAVE_NoError;
 		}
 		
-		UPackage::SavePackage(Package, nullptr, *PackageFileName, SaveArgs);
+		const bool bSaved = UPackage::SavePackage(InPackage, nullptr, *PackageFileName, SaveArgs);
 #else
-		UPackage::SavePackage(Package, nullptr, RF_Standalone, *PackageFileName);
+		const bool bSaved = UPackage::SavePackage(InPackage, nullptr, RF_Standalone, *PackageFileName);
 #endif
+
+		if (bSaved) {
+			FImportMemory::ReleaseSavedPackage(InPackage);
+		}
 	}
 }
 
@@ -519,6 +813,37 @@ bool IImporter::OnAssetCreation(UObject* Asset) const {
 	return Synced;
 }
 
+UObject* IImporter::FindAssetForDeltaReimport(const UClass* Class) const {
+	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
+	if (!Settings->AssetSettings.bReimportChangedPropertiesOnly || Package == nullptr) return nullptr;
+
+	UObject* ExistingAsset = StaticFindObjectFast(nullptr, Package, FName(*AssetName));
+
+	/* A different class can't be patched in place */
+	if (ExistingAsset == nullptr || ExistingAsset->GetClass() != Class) return nullptr;
+
+	return ExistingAsset;
+}
+
+bool IImporter::IsUnchangedSinceLastImport() const {
+	return !ExportsHash.IsEmpty() && Package != nullptr && FImportHashCache::IsUpToDate(Package->GetName(), ExportsHash);
+}
+
+bool IImporter::OnAssetReimport(UObject* Asset, const bool bChanged) const {
+	if (!bChanged) {
+		UE_LOG(LogJsonAsAsset, Log, TEXT("Reimported \"%s\" with no property changes, leaving it untouched"), *Asset->GetName());
+
+		bAssetUnchanged = true;
+
+		return true;
+	}
+
+	Asset->Modify();
+	Asset->MarkPackageDirty();
+
+	return OnAssetCreation(Asset);
+}
+
 FName IImporter::GetExportNameOfSubobject(const FString& PackageIndex) {
 	FString Name; {
 		PackageIndex.Split("'", nullptr, &Name);
@@ -554,6 +879,8 @@ TSharedPtr<FJsonValue> IImporter::GetExportByObjectPath(const TSharedPtr<FJsonOb
 }
 
 void IImporter::DeserializeExports(UObject* Parent) {
+	JSONASASSET_TRACE_SCOPE("DeserializeExports", DeserializeExports)
+
 	UObjectSerializer* ObjectSerializer = GetObjectSerializer();
 	ObjectSerializer->SetExportForDeserialization(JsonObject, Parent);
 	ObjectSerializer->Parent = Parent;
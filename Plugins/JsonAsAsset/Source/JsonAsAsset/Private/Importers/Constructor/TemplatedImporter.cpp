@@ -7,11 +7,20 @@ template class ITemplatedImporter<UObject>;
 
 template <typename AssetType>
 bool ITemplatedImporter<AssetType>::Import() {
-	AssetType* Asset = NewObject<AssetType>(Package, AssetClass ? AssetClass : AssetType::StaticClass(), FName(AssetName), RF_Public | RF_Standalone);
+	UClass* Class = AssetClass ? AssetClass : AssetType::StaticClass();
+	UObjectSerializer* ObjectSerializer = GetObjectSerializer();
 
-	Asset->MarkPackageDirty();
+	/* Reimport over the existing asset, writing only what changed */
+	AssetType* Asset = Cast<AssetType>(FindAssetForDeltaReimport(Class));
+	const bool bReimport = Asset != nullptr;
+
+	if (bReimport) {
+		ObjectSerializer->BeginPropertyDelta();
+	} else {
+		Asset = NewObject<AssetType>(Package, Class, FName(AssetName), RF_Public | RF_Standalone);
+		Asset->MarkPackageDirty();
+	}
 
-	UObjectSerializer* ObjectSerializer = GetObjectSerializer();
 	ObjectSerializer->SetExportForDeserialization(JsonObject, Asset);
 	ObjectSerializer->Parent = Asset;
 
@@ -19,5 +28,9 @@ bool ITemplatedImporter<AssetType>::Import() {
 	
 	GetObjectSerializer()->DeserializeObjectProperties(AssetData, Asset);
 
+	if (bReimport) {
+		return OnAssetReimport(Asset, ObjectSerializer->HasPropertyChanges());
+	}
+
 	return OnAssetCreation(Asset);
 }
@@ -14,6 +14,34 @@
 #include "AnimDataController.h"
 #endif
 
+#include "Utilities/ImportTrace.h"
+
+namespace {
+	/* A float curve decoded from the export, before it's added to the sequence */
+	struct FImportedFloatCurve {
+		FName Name;
+		int32 Flags = 0;
+
+		TArray<FRichCurveKey> Keys;
+	};
+
+#if ENGINE_UE5 && ENGINE_MINOR_VERSION < 3
+	const FLinearColor GCurveColors[] = {
+		FLinearColor(.904, .323, .539),
+		FLinearColor(.552, .737, .328),
+		FLinearColor(.947, .418, .219),
+		FLinearColor(.156, .624, .921),
+		FLinearColor(.921, .314, .337),
+		FLinearColor(.361, .651, .332),
+		FLinearColor(.982, .565, .254),
+		FLinearColor(.246, .223, .514),
+		FLinearColor(.208, .386, .687),
+		FLinearColor(.223, .590, .337),
+		FLinearColor(.230, .291, .591)
+	};
+#endif
+}
+
 bool IAnimationBaseImporter::Import() {
 	const FString JsonName = JsonObject->GetStringField(TEXT("Name"));
 
@@ -70,15 +98,6 @@ bool IAnimationBaseImporter::Import() {
 		UE_LOG(LogJsonAsAsset, Error, TEXT("Could not get valid Skeleton"));
 		return false;
 	}
-	
-	/* In Unreal Engine 5, a new data model has been added to edit animation curves */
-	/* Unreal Engine 5.2 changed handling getting a data model */
-#if UE5_2_BEYOND
-	IAnimationDataController& Controller = AnimSequenceBase->GetController();
-#if ENGINE_MINOR_VERSION >= 3
-	IAnimationDataModel* DataModel = AnimSequenceBase->GetDataModel();
-#endif
-#endif
 
 	/* Some CUE4Parse versions have different named objects for curves ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 	const TSharedPtr<FJsonObject>* RawCurveData;
@@ -89,146 +108,131 @@ bool IAnimationBaseImporter::Import() {
 	if (JsonObject->TryGetObjectField(TEXT("CompressedCurveData"), RawCurveData))
 		FloatCurves = JsonObject->GetObjectField(TEXT("CompressedCurveData"))->GetArrayField(TEXT("FloatCurves"));
 
-	/* Import the curves */
-	for (const TSharedPtr<FJsonValue> FloatCurveObject : FloatCurves) {
+	/* Decode every curve and its keys first, they're added to the sequence in one go */
+	TArray<FImportedFloatCurve> Curves;
+	Curves.Reserve(FloatCurves.Num());
+
+	int32 NumKeys = 0;
+
+	for (const TSharedPtr<FJsonValue>& FloatCurveValue : FloatCurves) {
+		const TSharedPtr<FJsonObject> FloatCurveObject = FloatCurveValue->AsObject();
+		if (!FloatCurveObject.IsValid()) continue;
+
+		FImportedFloatCurve& Curve = Curves.AddDefaulted_GetRef();
+
 		/* Curve Display Name */
-		FString DisplayName = "";
-		if (FloatCurveObject->AsObject()->HasField(TEXT("Name"))) {
-			DisplayName = FloatCurveObject->AsObject()->GetObjectField(TEXT("Name"))->GetStringField(TEXT("DisplayName"));
+		const TSharedPtr<FJsonObject>* NameObject;
+
+		if (FloatCurveObject->TryGetObjectField(TEXT("Name"), NameObject)) {
+			Curve.Name = FName(*(*NameObject)->GetStringField(TEXT("DisplayName")));
 		} else {
-			DisplayName = FloatCurveObject->AsObject()->GetStringField(TEXT("CurveName"));
+			Curve.Name = FName(*FloatCurveObject->GetStringField(TEXT("CurveName")));
 		}
 
 		/* Used to define if a curve is a curve is metadata or not. */
-		int CurveTypeFlags = FloatCurveObject->AsObject()->GetIntegerField(TEXT("CurveTypeFlags"));
+		Curve.Flags = FloatCurveObject->GetIntegerField(TEXT("CurveTypeFlags"));
 
-		/* Adding the track name to skeletons differ between Unreal Engine 4 and 5 ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-#if ENGINE_UE4
-		FSmartName NewTrackName;
+		/* Keys of the track */
+		const TArray<TSharedPtr<FJsonValue>>& Keys = FloatCurveObject->GetObjectField(TEXT("FloatCurve"))->GetArrayField(TEXT("Keys"));
+		Curve.Keys.Reserve(Keys.Num());
 
-		Skeleton->AddSmartNameAndModify(USkeleton::AnimCurveMappingName, FName(*DisplayName), NewTrackName);
-		ensureAlways(Skeleton->GetSmartNameByUID(USkeleton::AnimCurveMappingName, NewTrackName.UID, NewTrackName));
-#endif
-		
-#if ENGINE_UE5
-#if ENGINE_MINOR_VERSION <= 3
-		FSmartName NewTrackName;
+		for (const TSharedPtr<FJsonValue>& JsonKey : Keys) {
+			Curve.Keys.Add(ObjectToRichCurveKey(JsonKey->AsObject()));
+		}
 
-		Skeleton->AddSmartNameAndModify(USkeleton::AnimCurveMappingName, FName(*DisplayName), NewTrackName);
-		
-		ensureAlways(Skeleton->GetSmartNameByUID(USkeleton::AnimCurveMappingName, NewTrackName.UID, NewTrackName));
-		FAnimationCurveIdentifier CurveId = FAnimationCurveIdentifier(NewTrackName, ERawCurveTrackTypes::RCT_Float);
-#endif
-		/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-		
-#if ENGINE_MINOR_VERSION >= 4
-		Controller.OpenBracket(FText::FromString("Curve Import"));
+		NumKeys += Curve.Keys.Num();
+	}
 
-		/* Create Curve Identifier */
-		FName CurveName = FName(*DisplayName);
-		FAnimationCurveIdentifier CurveId(CurveName, ERawCurveTrackTypes::RCT_Float);
-
-		/* Add curve metadata to skeleton */
-		Skeleton->AddCurveMetaData(CurveName);
-		/* Add or update the curve */
-		const FFloatCurve* ExistingCurve = DataModel->FindFloatCurve(CurveId);
-		if (ExistingCurve != nullptr)
-		{
-			Controller.RemoveCurve(CurveId);
-		}
-		Controller.AddCurve(CurveId, CurveTypeFlags);
-#endif
-		/* For Unreal Engine 5.3 and above, the smart name's display name is required */
-#if ENGINE_MINOR_VERSION == 3 && ENGINE_PATCH_VERSION < 2
-		Controller->AddCurve(CurveId, CurveTypeFlags);
-#elif (ENGINE_MINOR_VERSION == 3 && ENGINE_PATCH_VERSION == 2)
-		Controller.AddCurve(CurveId, CurveTypeFlags);
-#endif
-		/* For Unreal Engine 5.2 and below, just the smart name is required */
-#if ENGINE_MINOR_VERSION < 3
-		AnimSequenceBase->Modify(true);
+	const double CurvesStartTime = FPlatformTime::Seconds();
 
-		IAnimationDataController& LocalOneController = AnimSequenceBase->GetController();
-		LocalOneController.AddCurve(FAnimationCurveIdentifier(NewTrackName, ERawCurveTrackTypes::RCT_Float), CurveTypeFlags);
-
-		TArray<FLinearColor> RandomizedColorArray = {
-			FLinearColor(.904, .323, .539),
-			FLinearColor(.552, .737, .328),
-			FLinearColor(.947, .418, .219),
-			FLinearColor(.156, .624, .921),
-			FLinearColor(.921, .314, .337),
-			FLinearColor(.361, .651, .332),
-			FLinearColor(.982, .565, .254),
-			FLinearColor(.246, .223, .514),
-			FLinearColor(.208, .386, .687),
-			FLinearColor(.223, .590, .337),
-			FLinearColor(.230, .291, .591)
-		}; { 
-			auto Index = rand() % RandomizedColorArray.Num();
-
-			if (RandomizedColorArray.IsValidIndex(Index)) {
-				LocalOneController.SetCurveColor(FAnimationCurveIdentifier(NewTrackName, ERawCurveTrackTypes::RCT_Float), RandomizedColorArray[Index]);
+	/*
+	 * Unreal Engine 5 and Unreal Engine 4
+	 * have different ways of adding curves
+	 *
+	 * Unreal Engine 4: Simply adding curves to RawCurveData
+	 * Unreal Engine 5: Using a AnimDataController to handle adding curves
+	*/
+	{
+		JSONASASSET_TRACE_SCOPE("ImportCurves", ImportCurves)
+
+#if ENGINE_UE4
+		FRawCurveTracks& Tracks = AnimSequenceBase->RawCurveData;
+
+		for (const FImportedFloatCurve& Curve : Curves) {
+			FSmartName NewTrackName;
+
+			Skeleton->AddSmartNameAndModify(USkeleton::AnimCurveMappingName, Curve.Name, NewTrackName);
+			Tracks.AddCurveData(NewTrackName, Curve.Flags);
+
+			/* Keys are set as a whole, instead of searching every track for each added key */
+			if (FFloatCurve* Track = static_cast<FFloatCurve*>(Tracks.GetCurveData(NewTrackName.UID, ERawCurveTrackTypes::RCT_Float))) {
+				Track->FloatCurve.SetKeys(Curve.Keys);
 			}
 		}
+#else
+		/* Unreal Engine 5.2 changed handling getting a data model */
+		IAnimationDataController& Controller = AnimSequenceBase->GetController();
 
-		AnimSequenceBase->PostEditChange();
-#endif
+#if ENGINE_MINOR_VERSION < 3
+		AnimSequenceBase->Modify(true);
 #endif
 
-		/* Keys of the track */
-		TArray<TSharedPtr<FJsonValue>> Keys = FloatCurveObject->AsObject()->GetObjectField(TEXT("FloatCurve"))->GetArrayField(TEXT("Keys"));
+		/* Every curve and key is added in one bracket, so the data model only notifies its sequence once it's closed */
+		Controller.OpenBracket(FText::FromString("Curve Import"));
 
-		for (const TSharedPtr<FJsonValue> JsonKey : Keys) {
-			TSharedPtr<FJsonObject> Key = JsonKey->AsObject();
+		for (const FImportedFloatCurve& Curve : Curves) {
+			/* Adding the track name to skeletons differ between Unreal Engine 5 versions ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+#if ENGINE_MINOR_VERSION <= 3
+			/* For Unreal Engine 5.3 and below, the smart name is required */
+			FSmartName NewTrackName;
 
-			FRichCurveKey RichKey = ObjectToRichCurveKey(Key);
+			Skeleton->AddSmartNameAndModify(USkeleton::AnimCurveMappingName, Curve.Name, NewTrackName);
+			const FAnimationCurveIdentifier CurveId(NewTrackName, ERawCurveTrackTypes::RCT_Float);
+#else
+			const FAnimationCurveIdentifier CurveId(Curve.Name, ERawCurveTrackTypes::RCT_Float);
 
-			/*
-			 * Unreal Engine 5 and Unreal Engine 4
-			 * have different ways of adding curves
-			 *
-			 * Unreal Engine 4: Simply adding curves to RawCurveData
-			 * Unreal Engine 5: Using a AnimDataController to handle adding curves
-			*/
-#if UE5_2_BEYOND
-			Controller.SetCurveKey(CurveId, RichKey);
-#endif
-#if ENGINE_UE4
-			FRawCurveTracks& Tracks = AnimSequenceBase->RawCurveData;
-#endif
-#if ENGINE_UE4
-			Tracks.AddFloatCurveKey(NewTrackName, CurveTypeFlags, RichKey.Time, RichKey.Value);
-
-			for (FFloatCurve& Track : Tracks.FloatCurves) {
-				if (Track.Name == NewTrackName) {
-					const int32 LastIndex = Track.FloatCurve.Keys.Num() - 1;
-					Track.FloatCurve.Keys[LastIndex].ArriveTangent = RichKey.ArriveTangent;
-					Track.FloatCurve.Keys[LastIndex].LeaveTangent = RichKey.LeaveTangent;
-					Track.FloatCurve.Keys[LastIndex].InterpMode = RichKey.InterpMode;
-				}
+			/* Add curve metadata to skeleton */
+			Skeleton->AddCurveMetaData(Curve.Name);
+
+			/* Add or update the curve */
+			if (AnimSequenceBase->GetDataModel()->FindFloatCurve(CurveId) != nullptr) {
+				Controller.RemoveCurve(CurveId);
 			}
 #endif
-#if UE5_1_BELOW
+			Controller.AddCurve(CurveId, Curve.Flags);
+
+#if ENGINE_MINOR_VERSION < 3
+			Controller.SetCurveColor(CurveId, GCurveColors[FMath::RandRange(0, UE_ARRAY_COUNT(GCurveColors) - 1)]);
 #endif
+
+			Controller.SetCurveKeys(CurveId, Curve.Keys);
 		}
-#if UE5_2_BEYOND
+
 		Controller.CloseBracket();
 #endif
 	}
 
+	const double CompressStartTime = FPlatformTime::Seconds();
+
+	/* Derived data is built once, after every curve is in */
+	if (CastedAnimSequence) {
+		JSONASASSET_TRACE_SCOPE("CompressAnimation", CompressAnimations)
+
 #if UE5_2_BEYOND
-	if (ITargetPlatform* RunningPlatform = GetTargetPlatformManagerRef().GetRunningTargetPlatform()) {
+		if (ITargetPlatform* RunningPlatform = GetTargetPlatformManagerRef().GetRunningTargetPlatform()) {
 #if UE5_6_BEYOND
-		CastedAnimSequence->CacheDerivedDataForPlatform(RunningPlatform);
+			CastedAnimSequence->CacheDerivedDataForPlatform(RunningPlatform);
 #else
-		CastedAnimSequence->CacheDerivedData(RunningPlatform);
+			CastedAnimSequence->CacheDerivedData(RunningPlatform);
 #endif
-	}
+		}
 #else
-	if (CastedAnimSequence) {
 		CastedAnimSequence->RequestSyncAnimRecompression();
-	}
 #endif
+	}
+
+	UE_LOG(LogJsonAsAsset, Log, TEXT("%s: imported %d curves (%d keys) in %.3f s, compressed in %.3f s"),
+		*AnimSequenceBase->GetName(), Curves.Num(), NumKeys, CompressStartTime - CurvesStartTime, FPlatformTime::Seconds() - CompressStartTime);
 
 #if ENGINE_UE4
 	AnimSequenceBase->MarkRawDataAsModified();
@@ -3,6 +3,22 @@
 #include "Importers/Types/Animation/PoseAssetImporter.h"
 #include "Animation/PoseAsset.h"
 
+/* PoseContainer (and the poses inside it) are private to UPoseAsset, so they're reached through reflection */
+static void SetSourceLocalSpacePoses(UPoseAsset* PoseAsset, TArray<TArray<FTransform>>& SourcePoses) {
+	const FStructProperty* ContainerProperty = FindFProperty<FStructProperty>(UPoseAsset::StaticClass(), TEXT("PoseContainer"));
+	if (ContainerProperty == nullptr) return;
+
+	const FArrayProperty* PosesProperty = FindFProperty<FArrayProperty>(ContainerProperty->Struct, TEXT("Poses"));
+	if (PosesProperty == nullptr) return;
+
+	TArray<FPoseData>& Poses = *PosesProperty->ContainerPtrToValuePtr<TArray<FPoseData>>(ContainerProperty->ContainerPtrToValuePtr<void>(PoseAsset));
+	const int32 NumPoses = FMath::Min(Poses.Num(), SourcePoses.Num());
+
+	for (int32 PoseIndex = 0; PoseIndex < NumPoses; PoseIndex++) {
+		Poses[PoseIndex].SourceLocalSpacePose = MoveTemp(SourcePoses[PoseIndex]);
+	}
+}
+
 bool IPoseAssetImporter::Import() {
 	PoseAsset = NewObject<UPoseAsset>(OutermostPkg, UPoseAsset::StaticClass(), *AssetName, RF_Standalone | RF_Public);
 
@@ -14,11 +30,15 @@ bool IPoseAssetImporter::Import() {
 	}), PoseAsset);
 
 	/* Reverse LocalSpacePose (cooked data) back to source data */
-	ReverseCookLocalSpacePose(PoseAsset->GetSkeleton());
+	TArray<TArray<FTransform>> SourcePoses;
+	ReverseCookLocalSpacePose(PoseAsset->GetSkeleton(), SourcePoses);
 
 	/* Final operation to set properties */
 	GetObjectSerializer()->DeserializeObjectProperties(AssetData, PoseAsset);
 
+	/* Written after the container is deserialized, otherwise it'd be overwritten */
+	SetSourceLocalSpacePoses(PoseAsset, SourcePoses);
+
 	/* If the user wants to specify a pose asset animation */
 	if (UAnimSequence* OptionalAnimationSequence = GetSelectedAsset<UAnimSequence>(true)) {
 		PoseAsset->SourceAnimation = OptionalAnimationSequence;
@@ -27,7 +47,7 @@ bool IPoseAssetImporter::Import() {
 	return OnAssetCreation(PoseAsset);
 }
 
-void IPoseAssetImporter::ReverseCookLocalSpacePose(USkeleton* Skeleton) const {
+void IPoseAssetImporter::ReverseCookLocalSpacePose(USkeleton* Skeleton, TArray<TArray<FTransform>>& OutSourcePoses) const {
 	/* If PoseContainer or Tracks don't exist, no need to perform any operations */
 	if (
 		!AssetData->HasField(TEXT("PoseContainer")) ||
@@ -37,98 +57,97 @@ void IPoseAssetImporter::ReverseCookLocalSpacePose(USkeleton* Skeleton) const {
 	}
 	
 	const TSharedPtr<FJsonObject> PoseContainer = AssetData->GetObjectField(TEXT("PoseContainer"));
-	const TArray<TSharedPtr<FJsonValue>> TracksJson = PoseContainer->GetArrayField(TEXT("Tracks"));
-	const TArray<TSharedPtr<FJsonValue>> PosesJson = PoseContainer->GetArrayField(TEXT("Poses"));
+	const TArray<TSharedPtr<FJsonValue>>& TracksJson = PoseContainer->GetArrayField(TEXT("Tracks"));
+	const TArray<TSharedPtr<FJsonValue>>& PosesJson = PoseContainer->GetArrayField(TEXT("Poses"));
 
 	const int32 NumTracks = TracksJson.Num();
 
-	for (TSharedPtr<FJsonValue> PoseValue : PosesJson) {
-		TSharedPtr<FJsonObject> Pose = PoseValue->AsObject();
+	TArray<FName> Tracks;
+	Tracks.Reserve(NumTracks);
+
+	for (const TSharedPtr<FJsonValue>& Track : TracksJson) {
+		Tracks.Add(FName(*Track->AsString()));
+	}
+
+	/* DefaultTransform can either be default, or extracted from the base skeleton. Looked up once for every track, not per pose */
+	TArray<FTransform> DefaultTransforms;
+	DefaultTransforms.Init(FTransform::Identity, NumTracks);
+
+	if (Skeleton) {
+		const FReferenceSkeleton& ReferenceSkeleton = Skeleton->GetReferenceSkeleton();
+		const TArray<FTransform>& ReferencePose = Skeleton->GetRefLocalPoses();
+
+		for (int32 TrackIndex = 0; TrackIndex < NumTracks; TrackIndex++) {
+			const int32 BoneIndex = ReferenceSkeleton.FindBoneIndex(Tracks[TrackIndex]);
+
+			if (ReferencePose.IsValidIndex(BoneIndex)) {
+				DefaultTransforms[TrackIndex] = ReferencePose[BoneIndex];
+			}
+		}
+	}
+
+	const bool bAdditive = PoseAsset->IsValidAdditive();
+
+	/* Track index -> index into LocalSpacePose, INDEX_NONE if the pose doesn't have the track */
+	TArray<int32> TrackToBufferIndex;
+
+	OutSourcePoses.Reset(PosesJson.Num());
+
+	for (const TSharedPtr<FJsonValue>& PoseValue : PosesJson) {
+		/* We take the cooked pose data [LocalSpacePose] and convert it back to SourceLocalSpacePose */
+		TArray<FTransform>& SourceLocalSpacePose = OutSourcePoses.Add_GetRef(DefaultTransforms);
+
+		const TSharedPtr<FJsonObject> Pose = PoseValue->AsObject();
 		
 		if (!Pose.IsValid()) {
 			continue;
 		}
 		
 		/* Read the optimized LocalSpacePose array */
-		TArray<TSharedPtr<FJsonValue>> LocalSpacePoseJson; {
-			if (Pose->HasField(TEXT("LocalSpacePose"))) {
-				LocalSpacePoseJson = Pose->GetArrayField(TEXT("LocalSpacePose"));
-			}
+		const TArray<TSharedPtr<FJsonValue>>* LocalSpacePoseJson = nullptr;
+		const TArray<TSharedPtr<FJsonValue>>* TrackToBufferJson = nullptr;
+
+		if (!Pose->TryGetArrayField(TEXT("LocalSpacePose"), LocalSpacePoseJson) || !Pose->TryGetArrayField(TEXT("TrackToBufferIndex"), TrackToBufferJson)) {
+			continue;
 		}
 
-		/* Build a mapping from track index (as int32) to index into LocalSpacePose. */
-		TMap<int32, int32> TrackToBufferIndex; {
-			if (Pose->HasField(TEXT("TrackToBufferIndex"))) {
-				const TArray<TSharedPtr<FJsonValue>> TrackToBufferJson = Pose->GetArrayField(TEXT("TrackToBufferIndex"));
-			
-				for (TSharedPtr<FJsonValue> TrackToBuffer : TrackToBufferJson) {
-					const TSharedPtr<FJsonObject> TrackToBufferObject = TrackToBuffer->AsObject();
-				
-					if (TrackToBufferObject.IsValid()) {
-						int32 Key = FCString::Atoi(*TrackToBufferObject->GetStringField(TEXT("Key")));
-						int32 Value = FCString::Atoi(*TrackToBufferObject->GetStringField(TEXT("Value")));
-					
-						TrackToBufferIndex.Add(Key, Value);
-					}
-				}
+		TrackToBufferIndex.Init(INDEX_NONE, NumTracks);
+
+		for (const TSharedPtr<FJsonValue>& TrackToBuffer : *TrackToBufferJson) {
+			const TSharedPtr<FJsonObject> TrackToBufferObject = TrackToBuffer->AsObject();
+			int32 Key, Value;
+
+			if (TrackToBufferObject.IsValid() && TrackToBufferObject->TryGetNumberField(TEXT("Key"), Key) && TrackToBufferObject->TryGetNumberField(TEXT("Value"), Value) && TrackToBufferIndex.IsValidIndex(Key)) {
+				TrackToBufferIndex[Key] = Value;
 			}
 		}
 
-		/* We take the cooked pose data [LocalSpacePoseJson] and convert it back to SourceLocalSpacePose */
-		TArray<TSharedPtr<FJsonValue>> SourceLocalSpacePose;
-		SourceLocalSpacePose.SetNum(NumTracks);
+		for (int32 TrackIndex = 0; TrackIndex < NumTracks; TrackIndex++) {
+			const int32 LocalIndex = TrackToBufferIndex[TrackIndex];
+			
+			if (!LocalSpacePoseJson->IsValidIndex(LocalIndex)) continue;
 
-		for (int32 i = 0; i < NumTracks; i++) {
-			/* DefaultTransform can either be default, or extracted from the base skeleton */
-			FTransform DefaultTransform = FTransform::Identity; {
-				if (Skeleton) {
-					const FReferenceSkeleton& ReferenceSkeleton = Skeleton->GetReferenceSkeleton();
-					const int32 BoneIndex = ReferenceSkeleton.FindBoneIndex(FName(*TracksJson[i]->AsString()));
-				
-					if (BoneIndex != INDEX_NONE) {
-						const TArray<FTransform> ReferencePose = Skeleton->GetRefLocalPoses();
-					
-						if (ReferencePose.IsValidIndex(BoneIndex)) {
-							DefaultTransform = ReferencePose[BoneIndex];
-						}
-					}
-				}
-			}
+			const TSharedPtr<FJsonObject> AdditiveJson = (*LocalSpacePoseJson)[LocalIndex]->AsObject();
+			if (!AdditiveJson.IsValid()) continue;
 
 			/* If a track is found, combine the transform data together (the engine cooks only the difference between the reference skeleton and the pose) */
-			if (TrackToBufferIndex.Contains(i)) {
-				const int32 LocalIndex = TrackToBufferIndex[i];
-				
-				if (LocalSpacePoseJson.IsValidIndex(LocalIndex)) {
-					const TSharedPtr<FJsonObject> AdditiveJson = LocalSpacePoseJson[LocalIndex]->AsObject();
-					if (!AdditiveJson.IsValid()) continue;
-					
-					const FTransform AdditiveTransform = GetTransformFromJson(AdditiveJson);
-
-					FTransform FullTransform = DefaultTransform; {
-						FullTransform.SetRotation(AdditiveTransform.GetRotation() * DefaultTransform.GetRotation());
-						FullTransform.SetTranslation(DefaultTransform.GetTranslation() + AdditiveTransform.GetTranslation());
-						FullTransform.SetScale3D(DefaultTransform.GetScale3D() + AdditiveTransform.GetScale3D());
-
-						if (!PoseAsset->IsValidAdditive()) {
-							FullTransform.SetRotation(AdditiveTransform.GetRotation());
-							FullTransform.SetTranslation(AdditiveTransform.GetTranslation());
-							FullTransform.SetScale3D(AdditiveTransform.GetScale3D());
-						}
-						
-						FullTransform.NormalizeRotation();
-					}
-
-					SourceLocalSpacePose[i] = MakeShareable(new FJsonValueObject(GetTransformJson(FullTransform)));
-					continue;
+			const FTransform AdditiveTransform = GetTransformFromJson(AdditiveJson);
+			const FTransform& DefaultTransform = DefaultTransforms[TrackIndex];
+
+			FTransform& FullTransform = SourceLocalSpacePose[TrackIndex]; {
+				if (bAdditive) {
+					FullTransform.SetRotation(AdditiveTransform.GetRotation() * DefaultTransform.GetRotation());
+					FullTransform.SetTranslation(DefaultTransform.GetTranslation() + AdditiveTransform.GetTranslation());
+					FullTransform.SetScale3D(DefaultTransform.GetScale3D() + AdditiveTransform.GetScale3D());
+				} else {
+					FullTransform.SetRotation(AdditiveTransform.GetRotation());
+					FullTransform.SetTranslation(AdditiveTransform.GetTranslation());
+					FullTransform.SetScale3D(AdditiveTransform.GetScale3D());
 				}
+				
+				FullTransform.NormalizeRotation();
 			}
-
-			SourceLocalSpacePose[i] = MakeShareable(new FJsonValueObject(GetTransformJson(DefaultTransform)));
 		}
-
-		/* Update the Pose with SourceLocalSpacePose */
-		Pose->SetArrayField(TEXT("SourceLocalSpacePose"), SourceLocalSpacePose);
 	}
 
 	FString CleanName = AssetName;
@@ -151,21 +170,19 @@ void IPoseAssetImporter::ReverseCookLocalSpacePose(USkeleton* Skeleton) const {
 
 	UPackage* AnimPackage = CreatePackage(*AnimSequencePackagePath);
 
-	if (UAnimSequence* AnimSequence = CreateAnimSequenceFromPose(Skeleton, CleanName, PoseContainer, AnimPackage)) {
+	if (UAnimSequence* AnimSequence = CreateAnimSequenceFromPose(Skeleton, CleanName, Tracks, OutSourcePoses, AnimPackage)) {
 		PoseAsset->SourceAnimation = AnimSequence;
 	}
 }
 
-UAnimSequence* IPoseAssetImporter::CreateAnimSequenceFromPose(USkeleton* Skeleton, const FString& SequenceName, const TSharedPtr<FJsonObject>& PoseContainer, UPackage* Outer) {
+UAnimSequence* IPoseAssetImporter::CreateAnimSequenceFromPose(USkeleton* Skeleton, const FString& SequenceName, const TArray<FName>& Tracks, const TArray<TArray<FTransform>>& SourcePoses, UPackage* Outer) {
 #if ENGINE_UE4
-	if (!Skeleton || !PoseContainer.IsValid()) {
+	if (!Skeleton) {
 		return nullptr;
 	}
 
-	const TArray<TSharedPtr<FJsonValue>> TracksJson = PoseContainer->GetArrayField(TEXT("Tracks"));
-	const TArray<TSharedPtr<FJsonValue>> PosesJson = PoseContainer->GetArrayField(TEXT("Poses"));
-	const int32 NumFrames = PosesJson.Num();
-	const int32 NumTracks = TracksJson.Num();
+	const int32 NumFrames = SourcePoses.Num();
+	const int32 NumTracks = Tracks.Num();
 
 	if (NumFrames == 0 || NumTracks == 0) {
 		return nullptr;
@@ -176,43 +193,40 @@ UAnimSequence* IPoseAssetImporter::CreateAnimSequenceFromPose(USkeleton* Skeleto
 
 	AnimSequence->SetRawNumberOfFrame(NumFrames);
 	AnimSequence->SequenceLength = (NumFrames > 1) ? static_cast<float>(NumFrames - 1) : 1.0f;
-	
-	TMap<FName, FRawAnimSequenceTrack> TrackMap; {
-		for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex) {
-			const FString TrackName = TracksJson[TrackIndex]->AsString();
 
-			if (const FName BoneName(*TrackName); Skeleton->GetReferenceSkeleton().FindBoneIndex(BoneName) != INDEX_NONE) {
-				TrackMap.Add(BoneName, FRawAnimSequenceTrack());
-			}
-		}
-	}
+	/* One raw track per pose track that exists on the skeleton */
+	TArray<FRawAnimSequenceTrack> RawTracks;
+	RawTracks.SetNum(NumTracks);
 
-	for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex) {
-		const TSharedPtr<FJsonObject> Pose = PosesJson[FrameIndex]->AsObject();
-		if (!Pose.IsValid()) continue;
+	TBitArray<> ValidTracks(false, NumTracks);
 
-		const TArray<TSharedPtr<FJsonValue>> SourceLocalSpacePose = Pose->GetArrayField(TEXT("SourceLocalSpacePose"));
-		
-		for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex) {
-			const FString TrackName = TracksJson[TrackIndex]->AsString();
-			const FName BoneName(*TrackName);
+	for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex) {
+		if (Skeleton->GetReferenceSkeleton().FindBoneIndex(Tracks[TrackIndex]) == INDEX_NONE) continue;
+
+		ValidTracks[TrackIndex] = true;
 
-			if (!TrackMap.Contains(BoneName)) continue;
+		RawTracks[TrackIndex].PosKeys.Reserve(NumFrames);
+		RawTracks[TrackIndex].RotKeys.Reserve(NumFrames);
+		RawTracks[TrackIndex].ScaleKeys.Reserve(NumFrames);
+	}
 
-			const TSharedPtr<FJsonObject> TransformJson = SourceLocalSpacePose[TrackIndex]->AsObject();
-			if (!TransformJson.IsValid()) continue;
+	for (const TArray<FTransform>& SourceLocalSpacePose : SourcePoses) {
+		for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex) {
+			if (!ValidTracks[TrackIndex] || !SourceLocalSpacePose.IsValidIndex(TrackIndex)) continue;
 
-			const FTransform Transform = GetTransformFromJson(TransformJson);
+			const FTransform& Transform = SourceLocalSpacePose[TrackIndex];
 
-			auto& [PosKeys, RotKeys, ScaleKeys] = TrackMap[BoneName];
+			auto& [PosKeys, RotKeys, ScaleKeys] = RawTracks[TrackIndex];
 			PosKeys.Add(Transform.GetTranslation());
 			RotKeys.Add(Transform.GetRotation());
 			ScaleKeys.Add(Transform.GetScale3D());
 		}
 	}
 
-	for (TPair<FName, FRawAnimSequenceTrack>& Pair : TrackMap) {
-		AnimSequence->AddNewRawTrack(Pair.Key, &Pair.Value);
+	for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex) {
+		if (ValidTracks[TrackIndex]) {
+			AnimSequence->AddNewRawTrack(Tracks[TrackIndex], &RawTracks[TrackIndex]);
+		}
 	}
 
 	AnimSequence->PostProcessSequence();
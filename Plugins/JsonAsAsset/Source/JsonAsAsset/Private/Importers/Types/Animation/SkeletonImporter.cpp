@@ -16,15 +16,18 @@ bool ISkeletonImporter::Import() {
 	if (!Skeleton) {
 		Skeleton = NewObject<USkeleton>(Package, USkeleton::StaticClass(), *AssetName, RF_Public | RF_Standalone);
 
-		ApplySkeletalChanges(Skeleton);
+		if (!ApplySkeletalChanges(Skeleton)) {
+			return false;
+		}
 	} else {
 		/* Empty the skeleton's sockets, blend profiles, and virtual bones */
 		Skeleton->Sockets.Empty();
 		Skeleton->BlendProfiles.Empty();
 
 		TArray<FName> VirtualBoneNames;
+		VirtualBoneNames.Reserve(Skeleton->GetVirtualBones().Num());
 
-		for (const FVirtualBone VirtualBone : Skeleton->GetVirtualBones()) {
+		for (const FVirtualBone& VirtualBone : Skeleton->GetVirtualBones()) {
 			VirtualBoneNames.Add(VirtualBone.VirtualBoneName);
 		}
 
@@ -32,7 +35,7 @@ bool ISkeletonImporter::Import() {
 		Skeleton->AnimRetargetSources.Empty();
 	}
 
-	/* Deserialize Skeleton */
+	/* Deserialize Skeleton, sockets and virtual bones are set as whole arrays, and only picked up by the rebuild at the end */
 	DeserializeExports(Skeleton);
 	GetObjectSerializer()->DeserializeObjectProperties(AssetData, Skeleton);
 
@@ -45,11 +48,14 @@ void ISkeletonImporter::DeserializeCurveMetaData(FCurveMetaData* OutMeta, const
 #if ENGINE_UE4
 	/* Untested in UE5 */
 	if (const TArray<TSharedPtr<FJsonValue>>* Bones = nullptr; Json->TryGetArrayField(TEXT("LinkedBones"), Bones)) {
+		OutMeta->LinkedBones.Reserve(OutMeta->LinkedBones.Num() + Bones->Num());
+
 		for (const auto& BoneVal : *Bones) {
-			if (auto BoneObj = BoneVal->AsObject()) {
+			if (const TSharedPtr<FJsonObject> BoneObj = BoneVal->AsObject()) {
 				FBoneReference Bone;
-				GetObjectSerializer()->PropertySerializer->DeserializeStruct(TBaseStructure<FBoneReference>::Get(), BoneObj.ToSharedRef(), &Bone);
-				OutMeta->LinkedBones.Add(MoveTemp(Bone));
+				Bone.BoneName = FName(*BoneObj->GetStringField(TEXT("BoneName")));
+
+				OutMeta->LinkedBones.Add(Bone);
 			}
 		}
 	}
@@ -68,132 +74,148 @@ void ISkeletonImporter::ApplyModifications() {
 	IImporter::ApplyModifications();
 
 #if ENGINE_UE4
-	/* If this export is found, this means the data is from UE5, and since we're on UE4, we need to move this into where it would be in UE4 */
+	/* If this export is found, this means the data is from UE5, and since we're on UE4, it's applied the same way as NameMappings */
 	const FUObjectExport AnimCurveMetaData = GetObjectSerializer()->GetPropertySerializer()->ExportsContainer.FindByType(FString("AnimCurveMetaData"));
 
 	if (AnimCurveMetaData.IsJsonValid()) {
-		const TSharedPtr<FJsonObject> CurveMetaDataProperties = AnimCurveMetaData.GetProperties();
-
-		if (CurveMetaDataProperties->HasField(TEXT("CurveMetaData"))) {
-			const TArray<TSharedPtr<FJsonValue>> CurveMetaData = CurveMetaDataProperties->GetArrayField(TEXT("CurveMetaData"));
-
-			FJsonObject* NameMappings = EnsureObjectField(AssetData, "NameMappings");
-			FJsonObject* AnimationCurves = EnsureObjectField(NameMappings, "AnimationCurves");
-			AnimationCurves->SetField("GuidMap", nullptr);
-			AnimationCurves->SetField("UidMap", nullptr);
-			
-			FJsonObject* CurveMetaDataMap = EnsureObjectField(AnimationCurves, "CurveMetaDataMap");
+		const TArray<TSharedPtr<FJsonValue>>* CurveMetaData;
 
-			ProcessJsonArrayField(CurveMetaDataProperties, TEXT("CurveMetaData"), [&](const TSharedPtr<FJsonObject>& ObjectField) {
-				const FString Key = ObjectField->GetStringField(TEXT("Key"));
-				const TSharedPtr<FJsonObject> Value = ObjectField->GetObjectField(TEXT("Value"));
-
-				CurveMetaDataMap->SetObjectField(Key, Value);
-			});
+		if (AnimCurveMetaData.GetProperties()->TryGetArrayField(TEXT("CurveMetaData"), CurveMetaData)) {
+			UE5CurveMetaData = *CurveMetaData;
 		}
 	}
 #endif
 }
 
-void ISkeletonImporter::ApplySkeletalChanges(USkeleton* Skeleton) const {
+bool ISkeletonImporter::ApplySkeletalChanges(USkeleton* Skeleton) const {
 	const TSharedPtr<FJsonObject> ReferenceSkeletonObject = AssetData->GetObjectField(TEXT("ReferenceSkeleton"));
 
-	/* Get access to ReferenceSkeleton */
-	FReferenceSkeleton& ReferenceSkeleton = const_cast<FReferenceSkeleton&>(Skeleton->GetReferenceSkeleton());
-	FReferenceSkeletonModifier ReferenceSkeletonModifier(ReferenceSkeleton, Skeleton);
+	const TArray<TSharedPtr<FJsonValue>>& FinalRefBoneInfo = ReferenceSkeletonObject->GetArrayField(TEXT("FinalRefBoneInfo"));
+	const TArray<TSharedPtr<FJsonValue>>& FinalRefBonePose = ReferenceSkeletonObject->GetArrayField(TEXT("FinalRefBonePose"));
 
-	TArray<TSharedPtr<FJsonValue>> FinalRefBoneInfo = ReferenceSkeletonObject->GetArrayField(TEXT("FinalRefBoneInfo"));
-	TArray<TSharedPtr<FJsonValue>> FinalRefBonePose = ReferenceSkeletonObject->GetArrayField(TEXT("FinalRefBonePose"));
+	/* Decode the bone table and the poses first, validating the hierarchy in the same pass */
+	const int32 NumBones = FMath::Min(FinalRefBoneInfo.Num(), FinalRefBonePose.Num());
 
-	int BoneIndex = 0;
+	TArray<FMeshBoneInfo> BoneInfos;
+	TArray<FTransform> BonePoses;
 
-	/* Go through each bone reference */
-	for (const TSharedPtr<FJsonValue> FinalReferenceBoneInfoValue : FinalRefBoneInfo) {
-		const TSharedPtr<FJsonObject> FinalReferenceBoneInfo = FinalReferenceBoneInfoValue->AsObject();
+	BoneInfos.Reserve(NumBones);
+	BonePoses.Reserve(NumBones);
 
-		FName Name(*FinalReferenceBoneInfo->GetStringField(TEXT("Name")));
-		const int ParentIndex = FinalReferenceBoneInfo->GetIntegerField(TEXT("ParentIndex"));
+	TSet<FName> BoneNames;
+	BoneNames.Reserve(NumBones);
+
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++) {
+		const TSharedPtr<FJsonObject> FinalReferenceBoneInfo = FinalRefBoneInfo[BoneIndex]->AsObject();
+		const TSharedPtr<FJsonObject> BonePoseTransform = FinalRefBonePose[BoneIndex]->AsObject();
 
 		/* Fail-safe */
-		if (!FinalRefBonePose.IsValidIndex(BoneIndex) || !FinalRefBonePose[BoneIndex].IsValid()) {
-			continue;
+		if (!FinalReferenceBoneInfo.IsValid() || !BonePoseTransform.IsValid()) {
+			break;
 		}
-		
-		TSharedPtr<FJsonObject> BonePoseTransform = FinalRefBonePose[BoneIndex]->AsObject();
-		FTransform Transform; {
-			PropertySerializer->DeserializeStruct(TBaseStructure<FTransform>::Get(), BonePoseTransform.ToSharedRef(), &Transform);
+
+		const FName Name(*FinalReferenceBoneInfo->GetStringField(TEXT("Name")));
+		const int32 ParentIndex = FinalReferenceBoneInfo->GetIntegerField(TEXT("ParentIndex"));
+
+		/* Parents always come before their children, and only the root has none */
+		if (BoneIndex == 0 ? ParentIndex != INDEX_NONE : !(ParentIndex >= 0 && ParentIndex < BoneIndex)) {
+			UE_LOG(LogJsonAsAsset, Error, TEXT("Skeleton %s: bone %s (%d) has an invalid parent index %d"), *AssetName, *Name.ToString(), BoneIndex, ParentIndex);
+			return false;
 		}
 
-		FMeshBoneInfo MeshBoneInfo = FMeshBoneInfo(Name, "", ParentIndex);
+		bool bAlreadyInSet = false;
+		BoneNames.Add(Name, &bAlreadyInSet);
 
-		/* Add the bone */
-		ReferenceSkeletonModifier.Add(MeshBoneInfo, Transform);
+		if (bAlreadyInSet) {
+			UE_LOG(LogJsonAsAsset, Error, TEXT("Skeleton %s: bone %s is defined more than once"), *AssetName, *Name.ToString());
+			return false;
+		}
 
-		BoneIndex++;
+		BoneInfos.Emplace(Name, TEXT(""), ParentIndex);
+		BonePoses.Add(GetTransformFromJson(BonePoseTransform));
+	}
+
+	/* Get access to ReferenceSkeleton */
+	FReferenceSkeleton& ReferenceSkeleton = const_cast<FReferenceSkeleton&>(Skeleton->GetReferenceSkeleton());
+	ReferenceSkeleton.Empty(BoneInfos.Num());
+
+	/* The modifier rebuilds the skeleton once it goes out of scope */
+	{
+		FReferenceSkeletonModifier ReferenceSkeletonModifier(ReferenceSkeleton, Skeleton);
+
+		for (int32 BoneIndex = 0; BoneIndex < BoneInfos.Num(); BoneIndex++) {
+			ReferenceSkeletonModifier.Add(BoneInfos[BoneIndex], BonePoses[BoneIndex]);
+		}
 	}
 
-	/* Re-build skeleton */
-	ReferenceSkeleton.RebuildRefSkeleton(Skeleton, true);
-	
 	Skeleton->ClearCacheData();
 	Skeleton->MarkPackageDirty();
+
+	return true;
 }
 
 void ISkeletonImporter::ApplySkeletalAssetData(USkeleton* Skeleton) const {
 	/* AnimationCurves ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #if ENGINE_UE4
-	if (AssetData->HasField("NameMappings")
-		&& AssetData->GetObjectField("NameMappings")->Values.Num() > 0
-		&& AssetData->GetObjectField("NameMappings")->HasField(TEXT("AnimationCurves"))
-		&& AssetData->GetObjectField("NameMappings")->GetObjectField(TEXT("AnimationCurves"))->HasField(TEXT("CurveMetaDataMap"))) {
+	/* Curve name -> metadata, from UE4 NameMappings or the UE5 AnimCurveMetaData export */
+	TArray<TPair<FName, TSharedPtr<FJsonObject>>> CurveMetaData;
 
-		TSharedPtr<FJsonObject> NameMappings = AssetData->GetObjectField("NameMappings");
-		TSharedPtr<FJsonObject> AnimationCurves = NameMappings->GetObjectField("AnimationCurves");
-		TSharedPtr<FJsonObject> CurveMetaDataMap = AnimationCurves->GetObjectField("CurveMetaDataMap");
+	const TSharedPtr<FJsonObject>* NameMappings;
+	const TSharedPtr<FJsonObject>* AnimationCurves;
+	const TSharedPtr<FJsonObject>* CurveMetaDataMap;
 
-		ProcessObjects(CurveMetaDataMap, [&](const FString& Name, const TSharedPtr<FJsonObject>& Object) {
-			FSmartName NewTrackName;
-			
-			Skeleton->AddSmartNameAndModify(USkeleton::AnimCurveMappingName, FName(*Name), NewTrackName);
-			ensureAlways(Skeleton->GetSmartNameByUID(USkeleton::AnimCurveMappingName, NewTrackName.UID, NewTrackName));
-			FCurveMetaData* CurveMetaData = Skeleton->GetCurveMetaData(FName(*Name));
+	if (AssetData->TryGetObjectField(TEXT("NameMappings"), NameMappings)
+		&& (*NameMappings)->TryGetObjectField(TEXT("AnimationCurves"), AnimationCurves)
+		&& (*AnimationCurves)->TryGetObjectField(TEXT("CurveMetaDataMap"), CurveMetaDataMap)) {
+		CurveMetaData.Reserve((*CurveMetaDataMap)->Values.Num());
 
-			DeserializeCurveMetaData(CurveMetaData, Object);
+		ProcessObjects(*CurveMetaDataMap, [&](const FString& Name, const TSharedPtr<FJsonObject>& Object) {
+			CurveMetaData.Emplace(FName(*Name), Object);
 		});
 	}
+
+	for (const TSharedPtr<FJsonValue>& Value : UE5CurveMetaData) {
+		if (const TSharedPtr<FJsonObject> Pair = Value->AsObject()) {
+			CurveMetaData.Emplace(FName(*Pair->GetStringField(TEXT("Key"))), Pair->GetObjectField(TEXT("Value")));
+		}
+	}
+
+	if (CurveMetaData.Num() > 0) {
+		Skeleton->Modify();
+
+		for (const TPair<FName, TSharedPtr<FJsonObject>>& Curve : CurveMetaData) {
+			FSmartName NewTrackName;
+
+			Skeleton->AddSmartNameAndModify(USkeleton::AnimCurveMappingName, Curve.Key, NewTrackName);
+
+			if (FCurveMetaData* Meta = Skeleton->GetCurveMetaData(Curve.Key)) {
+				DeserializeCurveMetaData(Meta, Curve.Value);
+			}
+		}
+	}
 #endif
 	
 	/* AnimRetargetSources ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-	const TSharedPtr<FJsonObject> AnimRetargetSources = AssetData->GetObjectField(TEXT("AnimRetargetSources"));
-
-	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : AnimRetargetSources->Values) {
-		const FName KeyName = FName(*Pair.Key);
-		const TSharedPtr<FJsonObject> RetargetObject = Pair.Value->AsObject();
+	const TSharedPtr<FJsonObject>* AnimRetargetSources;
 
-		const FName PoseName(*RetargetObject->GetStringField(TEXT("PoseName")));
+	if (AssetData->TryGetObjectField(TEXT("AnimRetargetSources"), AnimRetargetSources)) {
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*AnimRetargetSources)->Values) {
+			const TSharedPtr<FJsonObject> RetargetObject = Pair.Value->AsObject();
+			if (!RetargetObject.IsValid()) continue;
 
-		/* Array of transforms for each bone */
-		TArray<FTransform> ReferencePose;
+			/* Create reference pose, one transform for each bone */
+			FReferencePose RetargetSource;
+			RetargetSource.PoseName = FName(*RetargetObject->GetStringField(TEXT("PoseName")));
 
-		/* Add transforms for each bone */
-		TArray<TSharedPtr<FJsonValue>> ReferencePoseArray = RetargetObject->GetArrayField(TEXT("ReferencePose"));
+			const TArray<TSharedPtr<FJsonValue>>& ReferencePoseArray = RetargetObject->GetArrayField(TEXT("ReferencePose"));
+			RetargetSource.ReferencePose.Reserve(ReferencePoseArray.Num());
 
-		for (TSharedPtr<FJsonValue> ReferencePoseTransformValue : ReferencePoseArray) {
-			TSharedPtr<FJsonObject> ReferencePoseObject = ReferencePoseTransformValue->AsObject();
-			
-			FTransform Transform; {
-				PropertySerializer->DeserializeStruct(TBaseStructure<FTransform>::Get(), ReferencePoseObject.ToSharedRef(), &Transform);
+			for (const TSharedPtr<FJsonValue>& ReferencePoseTransformValue : ReferencePoseArray) {
+				RetargetSource.ReferencePose.Add(GetTransformFromJson(ReferencePoseTransformValue->AsObject()));
 			}
 
-			ReferencePose.Add(Transform);
+			Skeleton->AnimRetargetSources.Add(FName(*Pair.Key), MoveTemp(RetargetSource));
 		}
-			
-		/* Create reference pose */
-		FReferencePose RetargetSource;
-		RetargetSource.ReferencePose = ReferencePose;
-		RetargetSource.PoseName = PoseName;
-
-		Skeleton->AnimRetargetSources.Add(KeyName, RetargetSource);
 	}
 
 	RebuildSkeleton(Skeleton);
@@ -202,8 +224,7 @@ void ISkeletonImporter::ApplySkeletalAssetData(USkeleton* Skeleton) const {
 void ISkeletonImporter::RebuildSkeleton(const USkeleton* Skeleton) {
 	/* Get access to ReferenceSkeleton */
 	FReferenceSkeleton& ReferenceSkeleton = const_cast<FReferenceSkeleton&>(Skeleton->GetReferenceSkeleton());
-	FReferenceSkeletonModifier ReferenceSkeletonModifier(ReferenceSkeleton, Skeleton);
 
-	/* Re-build skeleton */
+	/* Re-build skeleton, picking up the virtual bones */
 	ReferenceSkeleton.RebuildRefSkeleton(Skeleton, true);
-}
\ No newline at end of file
+}
@@ -10,21 +10,21 @@ bool ISoundCueImporter::Import() {
 	SoundCue->PreEditChange(nullptr);
 	
 	/* Start importing nodes ~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-	if (SoundCue) {
-		TMap<FString, USoundNode*> SoundCueNodes;
-		
-		ConstructNodes(SoundCue, AllJsonObjects, SoundCueNodes);
-		SetupNodes(SoundCue, SoundCueNodes, AllJsonObjects);
-	}
+	FUObjectExportContainer SoundCueNodes;
+	
+	ConstructNodes(SoundCue, AllJsonObjects, SoundCueNodes);
+	SetupNodes(SoundCue, SoundCueNodes);
 	/* End of importing nodes ~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
 	GetObjectSerializer()->DeserializeObjectProperties(RemovePropertiesShared(AssetData, TArray<FString>
 	{
 		"FirstNode"
 	}), SoundCue);
+
+	/* The node tree is final, the editor graph is generated from it once instead of compiled back */
+	CreateGraphFromNodes(SoundCue);
 	
 	SoundCue->PostEditChange();
-	SoundCue->CompileSoundNodesFromGraphNodes();
 
 	return OnAssetCreation(SoundCue);
 }
@@ -115,7 +115,7 @@ bool IAnimationBlueprintImporter::Import() {
 		}
 	}
 
-	/* Separate main graph nodes (without "State" and "Machine") into RootGraphAnimProperties ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	/* Separate main graph nodes (without "State" and "Machine") into RootGraphAnimProperties, and index the others by their state ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 	const TSharedPtr<FJsonObject> RootGraphAnimProperties = MakeShared<FJsonObject>(); {
 		for (const FString& Key : NodesKeys) {
 			const TSharedPtr<FJsonValue> NodeValue = RootAnimNodeProperties->Values.FindChecked(Key);
@@ -125,6 +125,16 @@ bool IAnimationBlueprintImporter::Import() {
 			
 				if (!NodeObject->HasField(TEXT("State")) && !NodeObject->HasField(TEXT("Machine"))) {
 					RootGraphAnimProperties->SetObjectField(Key, NodeObject);
+				} else if (NodeObject->HasField(TEXT("State")) && NodeObject->HasField(TEXT("Machine"))) {
+					const TPair<FString, FString> StateKey(NodeObject->GetStringField(TEXT("Machine")), NodeObject->GetStringField(TEXT("State")));
+
+					TSharedPtr<FJsonObject>& StateProperties = StateAnimNodeProperties.FindOrAdd(StateKey);
+
+					if (!StateProperties.IsValid()) {
+						StateProperties = MakeShared<FJsonObject>();
+					}
+
+					StateProperties->SetObjectField(Key, NodeObject);
 				}
 			}
 		}
@@ -136,12 +146,20 @@ bool IAnimationBlueprintImporter::Import() {
 		AnimGraph->SubGraphs.Empty();
 	}
 
+	const double GraphStartTime = FPlatformTime::Seconds();
+
+	/* Every graph is built and wired first, the blueprint is compiled once at the end */
 	CreateGraph(RootGraphAnimProperties, AnimGraph, RootAnimNodeContainer);
 
+	const double CompileStartTime = FPlatformTime::Seconds();
+
 	FKismetEditorUtilities::CompileBlueprint(
 		AnimBlueprint,
 		EBlueprintCompileOptions::None
 	);
+
+	UE_LOG(LogJsonAsAsset, Log, TEXT("%s: built %d graphs (%d nodes) in %.3f s, compiled in %.3f s"),
+		*AnimBlueprint->GetName(), NumGraphsCreated, NumNodesCreated, CompileStartTime - GraphStartTime, FPlatformTime::Seconds() - CompileStartTime);
 	
 	return OnAssetCreation(AnimBlueprint);
 }
@@ -182,6 +200,7 @@ void IAnimationBlueprintImporter::CreateGraph(const TSharedPtr<FJsonObject>& Ani
 		AnimGraph->SubGraphs.Empty();
 	}
 	
+	/* Create every node of the graph, then wire them all in one pass */
 	CreateAnimGraphNodes(AnimGraph, AnimNodeProperties, Container);
 	AddNodesToGraph(AnimGraph, Container);
 
@@ -189,6 +208,9 @@ void IAnimationBlueprintImporter::CreateGraph(const TSharedPtr<FJsonObject>& Ani
 	ConnectAnimGraphNodes(Container, AnimGraph);
 	AutoLayoutAnimGraphNodes(Container.Exports);
 
+	NumGraphsCreated++;
+	NumNodesCreated += Container.Num();
+
 	for (const FUObjectExport ExportNode : Container.Exports) {
 		const TSharedPtr<FJsonObject> ExportJsonObject = ExportNode.JsonObject;
 		
@@ -217,37 +239,23 @@ void IAnimationBlueprintImporter::CreateGraph(const TSharedPtr<FJsonObject>& Ani
 			/* Add nodes to graph */
 			if (!StateMachineObject->HasField(TEXT("States"))) continue;
 
-			TArray<TSharedPtr<FJsonValue>> States = StateMachineObject->GetArrayField(TEXT("States"));
+			const TArray<TSharedPtr<FJsonValue>>& States = StateMachineObject->GetArrayField(TEXT("States"));
+
+			/* State name -> its graph, looked up once per machine */
+			TMap<FString, UAnimationStateGraph*> StateGraphs;
+
+			for (UEdGraph* SubGraph : EditorStateMachineGraph->SubGraphs) {
+				StateGraphs.Add(SubGraph->GetName(), Cast<UAnimationStateGraph>(SubGraph));
+			}
 
 			for (const TSharedPtr<FJsonValue>& StateValue : States) {
 				const TSharedPtr<FJsonObject> StateObject = StateValue->AsObject();
 				FString StateName = StateObject->GetStringField(TEXT("StateName"));
 
-				UAnimationStateGraph* Graph = nullptr;
-
-				for (UEdGraph* SubGraph : EditorStateMachineGraph->SubGraphs) {
-					if (SubGraph->GetName() == StateName) {
-						Graph = Cast<UAnimationStateGraph>(SubGraph);
-					}
-				}
-
-				TSharedPtr<FJsonObject> StateMachineAnimNodeProperties = MakeShared<FJsonObject>();
-
-				for (const auto& Pair : RootAnimNodeProperties->Values) {
-					const  FString Key = Pair.Key;
-					const TSharedPtr<FJsonObject> Value = Pair.Value->AsObject();
-
-					if (!Value.IsValid()) continue;
-
-					if (Value->HasField(TEXT("State")) && Value->HasField(TEXT("Machine"))) {
-						const FString NodeStateName = Value->GetStringField(TEXT("State"));
-						const FString NodeMachineName = Value->GetStringField(TEXT("Machine"));
+				UAnimationStateGraph* Graph = StateGraphs.FindRef(StateName);
 
-						if (StateName == NodeStateName && NodeMachineName == MachineName) {
-							StateMachineAnimNodeProperties->SetObjectField(Key, Value);
-						}
-					}
-				}
+				const TSharedPtr<FJsonObject>* StateProperties = StateAnimNodeProperties.Find(TPair<FString, FString>(MachineName, StateName));
+				const TSharedPtr<FJsonObject> StateMachineAnimNodeProperties = StateProperties != nullptr ? *StateProperties : MakeShared<FJsonObject>();
 
 				if (Graph) {
 					FUObjectExportContainer StateMachineContainer;
@@ -271,6 +279,7 @@ void IAnimationBlueprintImporter::CreateGraph(const TSharedPtr<FJsonObject>& Ani
 	}
 }
 
+/* Linking modifies both nodes, the graph is modified once by the caller */
 void inline LinkPoseInputPin(const FString& PinName, UAnimGraphNode_Base* Node, UAnimGraphNode_Base* TargetNode, UEdGraph* AnimGraph) {
 	UEdGraphPin* InputPin = Node->FindPin(PinName, EGPD_Input);
 	UEdGraphPin* OutputPin = GetFirstOutputPin(TargetNode);
@@ -278,10 +287,6 @@ void inline LinkPoseInputPin(const FString& PinName, UAnimGraphNode_Base* Node,
 	if (InputPin && OutputPin) {
 		InputPin->MakeLinkTo(OutputPin);
 		InputPin->DefaultValue.Reset();
-		
-		Node->Modify();
-		TargetNode->Modify();
-		AnimGraph->Modify();
 	}
 }
 
@@ -432,11 +437,7 @@ void IAnimationBlueprintImporter::CreateAnimGraphNodes(UEdGraph* AnimGraph, cons
 			if (!NodeGuid.IsValid()) NodeGuid = FGuid();
 		}
 
-#if UE5_6_BEYOND
-		const UClass* Class = FindFirstObject<UClass>(*NodeType);
-#else
-		const UClass* Class = FindObject<UClass>(ANY_PACKAGE, *NodeType);
-#endif
+		const UClass* Class = FTypeResolver::FindClass(NodeType);
 		if (!Class) continue;
 
 		UAnimGraphNode_Base* Node = NewObject<UAnimGraphNode_Base>(AnimGraph, Class, NAME_None, RF_Transactional);
@@ -472,7 +473,9 @@ void IAnimationBlueprintImporter::AddNodesToGraph(UEdGraph* AnimGraph, FUObjectE
 void IAnimationBlueprintImporter::HandleNodeDeserialization(FUObjectExportContainer& Container) {
 	GetObjectSerializer()->GetPropertySerializer()->BlacklistedPropertyNames.Add(TEXT("LinkID"));
 
-	for (FUObjectExport NodeExport : Container.Exports) {
+	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
+
+	for (FUObjectExport& NodeExport : Container.Exports) {
 		if (NodeExport.Object == nullptr) continue;
 
 		UAnimGraphNode_Base* Node = Cast<UAnimGraphNode_Base>(NodeExport.Object);
@@ -534,7 +537,6 @@ void IAnimationBlueprintImporter::HandleNodeDeserialization(FUObjectExportContai
 
 		HandlePropertyBinding(NodeExport, AllJsonObjects, Node, this, AnimBlueprint);
 
-		const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
 		if (Settings->AssetSettings.AnimationBlueprintImportSettings.bShowAllNodeKeysAsComment) {
 			Node->NodeComment = NodeExport.Name.ToString();
 			Node->bCommentBubbleVisible = true;
@@ -546,20 +548,41 @@ void IAnimationBlueprintImporter::HandleNodeDeserialization(FUObjectExportContai
 }
 
 void IAnimationBlueprintImporter::ConnectAnimGraphNodes(FUObjectExportContainer& Container, UEdGraph* AnimGraph) {
-    for (const FUObjectExport Export : Container.Exports) {
+	AnimGraph->Modify();
+
+    for (const FUObjectExport& Export : Container.Exports) {
         UAnimGraphNode_Base* Node = Cast<UAnimGraphNode_Base>(Export.Object);
         const TSharedPtr<FJsonObject> Json = Export.JsonObject;
 
+        if (!Node || !Json.IsValid()) {
+            continue;
+        }
+
         if (Cast<UAnimGraphNode_BlendListByEnum>(Node)) {
             UpdateBlendListByEnumVisibleEntries(Export, Container, AnimGraph);
         	continue;
         }
+
+        /* The anim node struct of this node, looked up once instead of for every link */
+        const FStructProperty* NodeProp = GetNodeStructProperty(Node);
+
+        if (!NodeProp) {
+            continue;
+        }
     	
         for (const auto& Pair : Json->Values) {
             const FString& Key = Pair.Key;
             const TSharedPtr<FJsonValue>& Value = Pair.Value;
             
             if (Value->Type == EJson::Array) {
+                /* Only arrays of pose links become indexed pins */
+                const FArrayProperty* ArrayProp = CastField<FArrayProperty>(NodeProp->Struct->FindPropertyByName(FName(*Key)));
+                const FStructProperty* InnerStruct = ArrayProp ? CastField<FStructProperty>(ArrayProp->Inner) : nullptr;
+
+                if (!InnerStruct || !InnerStruct->Struct->IsChildOf(FPoseLinkBase::StaticStruct())) {
+                    continue;
+                }
+
                 const TArray<TSharedPtr<FJsonValue>>& JsonArray = Value->AsArray();
                 
                 for (int32 Index = 0; Index < JsonArray.Num(); ++Index) {
@@ -581,33 +604,16 @@ void IAnimationBlueprintImporter::ConnectAnimGraphNodes(FUObjectExportContainer&
                         continue;
                     }
                     
-                    const FStructProperty* NodeProp = GetNodeStructProperty(Node);
-                    if (!NodeProp) {
-                        continue;
-                    }
-                    
-                    for (TFieldIterator<FProperty> It(NodeProp->Struct); It; ++It) {
-                        FProperty* Property = *It;
-                        
-                        if (Property->GetName() != Pair.Key) {
-                            continue;
-                        }
-                        
-                        if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property)) {
-                            const FStructProperty* InnerStruct = CastField<FStructProperty>(ArrayProp->Inner);
-                            
-                            if (!InnerStruct || !InnerStruct->Struct->IsChildOf(FPoseLinkBase::StaticStruct())) {
-                                continue;
-                            }
-                            
-                            const FString IndexedPinName = FString::Printf(TEXT("%s_%d"), *Pair.Key, Index);
-                            LinkPoseInputPin(IndexedPinName, Node, TargetNode, AnimGraph);
-                        }
-                    }
+                    const FString IndexedPinName = FString::Printf(TEXT("%s_%d"), *Key, Index);
+                    LinkPoseInputPin(IndexedPinName, Node, TargetNode, AnimGraph);
                 }
             }
             
             if (Value->Type == EJson::Object && Value->AsObject()->HasTypedField<EJson::String>("LinkID")) {
+                if (NodeProp->Struct->FindPropertyByName(FName(*Key)) == nullptr) {
+                    continue;
+                }
+
                 const FString LinkID = Value->AsObject()->GetStringField(TEXT("LinkID"));
                 UAnimGraphNode_Base* TargetNode = Cast<UAnimGraphNode_Base>(Container.Find(LinkID).Object);
                 
@@ -615,24 +621,13 @@ void IAnimationBlueprintImporter::ConnectAnimGraphNodes(FUObjectExportContainer&
                     continue;
                 }
                 
-                const FStructProperty* NodeProp = GetNodeStructProperty(Node);
-
-                if (!NodeProp) {
-                    continue;
-                }
-                
-                for (TFieldIterator<FProperty> It(NodeProp->Struct); It; ++It) {
-                    const FProperty* Property = *It;
-                    
-                    if (Property->GetName() != Pair.Key) {
-                        continue;
-                    }
-                    
-                    LinkPoseInputPin(Key, Node, TargetNode, AnimGraph);
-                }
+                LinkPoseInputPin(Key, Node, TargetNode, AnimGraph);
             }
         }
     }
+
+	/* One notification once every pin is wired */
+	AnimGraph->NotifyGraphChanged();
 }
 
 /* In newer versions of Unreal Engine, EvaluateGraphExposedInputs was moved to the main AnimBlueprintGeneratedClass class */
@@ -137,8 +137,8 @@ inline void CreateStateMachineGraph(
 	UAnimationStateMachineGraph* StateMachineGraph,
 	const TSharedPtr<FJsonObject>& StateMachineJsonObject,
 	UObjectSerializer* ObjectSerializer,
-	FUObjectExportContainer RootContainer,
-	TArray<FString> ReversedNodesKeys,
+	FUObjectExportContainer& RootContainer,
+	const TArray<FString>& ReversedNodesKeys,
 	IImporter* Importer,
 	UAnimBlueprint* AnimBlueprint
 ) {
@@ -356,10 +356,10 @@ inline void CreateStateMachineGraph(
 		if (EntryOutputPin && InitialInputPin) {
 			if (Schema) {
 				Schema->TryCreateConnection(EntryOutputPin, InitialInputPin);
-				StateMachineGraph->NotifyGraphChanged();
 			}
 		}
 	}
 
+	/* Notifies the graph once everything is connected */
 	AutoLayoutStateMachineGraph(StateMachineGraph);
 }
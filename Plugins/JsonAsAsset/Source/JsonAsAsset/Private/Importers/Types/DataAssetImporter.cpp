@@ -4,16 +4,29 @@
 #include "Engine/DataAsset.h"
 
 bool IDataAssetImporter::Import() {
-	UDataAsset* DataAsset = NewObject<UDataAsset>(Package, AssetClass, FName(AssetName), RF_Public | RF_Standalone);
-	auto _ = DataAsset->MarkPackageDirty();
-
 	UObjectSerializer* ObjectSerializer = GetObjectSerializer();
+
+	/* Reimport over the existing data asset, writing only what changed */
+	UDataAsset* DataAsset = Cast<UDataAsset>(FindAssetForDeltaReimport(AssetClass));
+	const bool bReimport = DataAsset != nullptr;
+
+	if (bReimport) {
+		ObjectSerializer->BeginPropertyDelta();
+	} else {
+		DataAsset = NewObject<UDataAsset>(Package, AssetClass, FName(AssetName), RF_Public | RF_Standalone);
+		auto _ = DataAsset->MarkPackageDirty();
+	}
+
 	ObjectSerializer->SetExportForDeserialization(JsonObject, DataAsset);
 	ObjectSerializer->Parent = DataAsset;
 
 	ObjectSerializer->DeserializeExports(AllJsonObjects);
 
 	ObjectSerializer->DeserializeObjectProperties(AssetData, DataAsset);
+
+	if (bReimport) {
+		return OnAssetReimport(DataAsset, ObjectSerializer->HasPropertyChanges());
+	}
 	
 	return OnAssetCreation(DataAsset);
 }
@@ -2,8 +2,14 @@
 
 #include "Importers/Types/Materials/MaterialFunctionImporter.h"
 #include "Factories/MaterialFunctionFactoryNew.h"
+#include "Utilities/MaterialCompileBatch.h"
 
 bool IMaterialFunctionImporter::Import() {
+	/* Rebuilding the graph of identical exports would only recompile every material using it */
+	if (UObject* ExistingFunction = FindAssetForDeltaReimport(UMaterialFunction::StaticClass()); ExistingFunction != nullptr && IsUnchangedSinceLastImport()) {
+		return OnAssetReimport(ExistingFunction, false);
+	}
+
 	/* Create Material Function Factory (factory automatically creates the Material Function) */
 	UMaterialFunctionFactoryNew* MaterialFunctionFactory = NewObject<UMaterialFunctionFactoryNew>();
 	UMaterialFunction* MaterialFunction = Cast<UMaterialFunction>(MaterialFunctionFactory->FactoryCreateNew(UMaterialFunction::StaticClass(), OutermostPkg, *AssetName, RF_Standalone | RF_Public, nullptr, GWarn));
@@ -39,8 +45,11 @@ bool IMaterialFunctionImporter::Import() {
 	/* Deserialize any properties */
 	GetObjectSerializer()->DeserializeObjectProperties(AssetData, MaterialFunction);
 	
-	MaterialFunction->PreEditChange(nullptr);
-	MaterialFunction->PostEditChange();
+	/* Materials using this function recompile when it changes, in a batch that happens once */
+	if (!FMaterialCompileBatch::Defer(MaterialFunction)) {
+		MaterialFunction->PreEditChange(nullptr);
+		MaterialFunction->PostEditChange();
+	}
 
 	SavePackage();
 	
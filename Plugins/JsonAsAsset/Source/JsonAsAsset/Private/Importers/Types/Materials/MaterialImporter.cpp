@@ -11,8 +11,14 @@
 
 #include "Factories/MaterialFactoryNew.h"
 #include "Settings/JsonAsAssetSettings.h"
+#include "Utilities/MaterialCompileBatch.h"
 
 bool IMaterialImporter::Import() {
+	/* Rebuilding the graph of identical exports would only recompile the same shaders */
+	if (UObject* ExistingMaterial = FindAssetForDeltaReimport(UMaterial::StaticClass()); ExistingMaterial != nullptr && IsUnchangedSinceLastImport()) {
+		return OnAssetReimport(ExistingMaterial, false);
+	}
+
 	/* Create Material Factory (factory automatically creates the Material) */
 	UMaterialFactoryNew* MaterialFactory = NewObject<UMaterialFactoryNew>();
 	UMaterial* Material = Cast<UMaterial>(MaterialFactory->FactoryCreateNew(UMaterial::StaticClass(), OutermostPkg, *AssetName, RF_Standalone | RF_Public, nullptr, GWarn));
@@ -65,7 +71,11 @@ bool IMaterialImporter::Import() {
 		}
 		
 		/* Connect all pins using deserializer */
-		GetObjectSerializer()->DeserializeObjectProperties(RawConnectionData, EditorOnlyData);
+		{
+			TGuardValue<const FUObjectExportContainer*> LocalExportsGuard(GetObjectSerializer()->GetPropertySerializer()->LocalExports, &ExpressionContainer);
+
+			GetObjectSerializer()->DeserializeObjectProperties(RawConnectionData, EditorOnlyData);
+		}
 
 		/* CustomizedUVs defined here */
 		const TArray<TSharedPtr<FJsonValue>>* InputsPtr;
@@ -125,15 +135,19 @@ bool IMaterialImporter::Import() {
 	GetObjectSerializer()->DeserializeObjectProperties(AssetData, Material);
 
 	Material->UpdateCachedExpressionData();
+
+	if (!FMaterialCompileBatch::Defer(Material)) {
+		FMaterialUpdateContext MaterialUpdateContext;
+		MaterialUpdateContext.AddMaterial(Material);
 	
-	FMaterialUpdateContext MaterialUpdateContext;
-	MaterialUpdateContext.AddMaterial(Material);
-	
-	Material->ForceRecompileForRendering();
+		Material->ForceRecompileForRendering();
 
-	Material->PostEditChange();
-	Material->MarkPackageDirty();
-	Material->PreEditChange(nullptr);
+		Material->PostEditChange();
+		Material->MarkPackageDirty();
+		Material->PreEditChange(nullptr);
+	} else {
+		Material->MarkPackageDirty();
+	}
 
 	SavePackage();
 
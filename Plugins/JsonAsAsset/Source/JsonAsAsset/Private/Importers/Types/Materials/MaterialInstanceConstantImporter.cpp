@@ -2,6 +2,7 @@
 
 #include "Importers/Types/Materials/MaterialInstanceConstantImporter.h"
 #include "Materials/MaterialInstanceConstant.h"
+#include "Utilities/MaterialCompileBatch.h"
 #include "Dom/JsonObject.h"
 #include "RHIDefinitions.h"
 #include "MaterialShared.h"
@@ -124,10 +125,17 @@ bool IMaterialInstanceConstantImporter::Import() {
 	}
 
 #if UE5_2_BEYOND || UE4_27_BELOW
-	FMaterialUpdateContext MaterialUpdateContext(FMaterialUpdateContext::EOptions::Default & ~FMaterialUpdateContext::EOptions::RecreateRenderStates);
+	/* Compiles the permutation, in a batch only once the parent has compiled */
+	const FMaterialCompileBatch::FWork UpdateStaticPermutation = [MaterialInstanceConstant, NewStaticParameterSet](FMaterialUpdateContext& MaterialUpdateContext) {
+		MaterialInstanceConstant->UpdateStaticPermutation(NewStaticParameterSet, &MaterialUpdateContext);
+		MaterialInstanceConstant->InitStaticPermutation();
+	};
+
+	if (!FMaterialCompileBatch::Defer(MaterialInstanceConstant, UpdateStaticPermutation)) {
+		FMaterialUpdateContext MaterialUpdateContext(FMaterialUpdateContext::EOptions::Default & ~FMaterialUpdateContext::EOptions::RecreateRenderStates);
 
-	MaterialInstanceConstant->UpdateStaticPermutation(NewStaticParameterSet, &MaterialUpdateContext);
-	MaterialInstanceConstant->InitStaticPermutation();
+		UpdateStaticPermutation(MaterialUpdateContext);
+	}
 #endif
 
 	return OnAssetCreation(MaterialInstanceConstant);
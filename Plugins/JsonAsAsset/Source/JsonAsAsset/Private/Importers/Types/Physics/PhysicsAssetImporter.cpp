@@ -5,6 +5,27 @@
 
 #include "PhysicsEngine/PhysicsConstraintTemplate.h"
 
+TArray<IPhysicsAssetImporter::FPhysicsSubobjectExport> IPhysicsAssetImporter::ParseSubobjectExports(const TSharedPtr<FJsonObject>& AssetData, const FString& FieldName, const TMap<FName, FExportData>& Exports) {
+	TArray<FPhysicsSubobjectExport> SubobjectExports;
+
+	ProcessJsonArrayField(AssetData, FieldName, [&](const TSharedPtr<FJsonObject>& ObjectField) {
+		const FName ExportName = GetExportNameOfSubobject(ObjectField->GetStringField(TEXT("ObjectName")));
+		const FExportData* Export = Exports.Find(ExportName);
+
+		if (Export == nullptr) {
+			UE_LOG(LogJsonAsAsset, Warning, TEXT("%s references missing export %s"), *FieldName, *ExportName.ToString());
+			return;
+		}
+
+		FPhysicsSubobjectExport& SubobjectExport = SubobjectExports.AddDefaulted_GetRef(); {
+			SubobjectExport.ExportName = ExportName;
+			SubobjectExport.Properties = Export->Json->GetObjectField(TEXT("Properties"));
+		}
+	});
+
+	return SubobjectExports;
+}
+
 bool IPhysicsAssetImporter::Import() {
 	/* CollisionDisableTable is required to port physics assets */
 	if (!AssetData->HasField(TEXT("CollisionDisableTable"))) {
@@ -16,53 +37,54 @@ bool IPhysicsAssetImporter::Import() {
 	UPhysicsAsset* PhysicsAsset = NewObject<UPhysicsAsset>(Package, UPhysicsAsset::StaticClass(), *AssetName, RF_Public | RF_Standalone);
 
 	TMap<FName, FExportData> Exports = CreateExports();
-	
+
+	/* Parse every body and constraint before creating anything ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	TArray<FPhysicsSubobjectExport> BodyExports = ParseSubobjectExports(AssetData, TEXT("SkeletalBodySetups"), Exports);
+	TArray<FPhysicsSubobjectExport> ConstraintExports = ParseSubobjectExports(AssetData, TEXT("ConstraintSetup"), Exports);
+
 	/* SkeletalBodySetups ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-	ProcessJsonArrayField(AssetData, TEXT("SkeletalBodySetups"), [&](const TSharedPtr<FJsonObject>& ObjectField) {
-		const FName ExportName = GetExportNameOfSubobject(ObjectField->GetStringField(TEXT("ObjectName")));
-		const FJsonObject* ExportJson = Exports.Find(ExportName)->Json;
+	PhysicsAsset->SkeletalBodySetups.Reserve(BodyExports.Num());
 
-		const TSharedPtr<FJsonObject> ExportProperties = ExportJson->GetObjectField(TEXT("Properties"));
-		const FName BoneName = FName(*ExportProperties->GetStringField(TEXT("BoneName")));
+	for (const FPhysicsSubobjectExport& BodyExport : BodyExports) {
+		const FName BoneName = FName(*BodyExport.Properties->GetStringField(TEXT("BoneName")));
 		
-		USkeletalBodySetup* BodySetup = CreateNewBody(PhysicsAsset, ExportName, BoneName);
+		USkeletalBodySetup* BodySetup = CreateNewBody(PhysicsAsset, BodyExport.ExportName, BoneName);
 
-		GetObjectSerializer()->DeserializeObjectProperties(ExportProperties, BodySetup);
-	});
-
-	/* For caching. IMPORTANT! DO NOT REMOVE! */
-	PhysicsAsset->UpdateBodySetupIndexMap();
-	PhysicsAsset->UpdateBoundsBodiesArray();
+		GetObjectSerializer()->DeserializeObjectProperties(BodyExport.Properties, BodySetup);
+	}
 
 	/* CollisionDisableTable ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-	TArray<TSharedPtr<FJsonValue>> CollisionDisableTable = AssetData->GetArrayField(TEXT("CollisionDisableTable"));
+	const TArray<TSharedPtr<FJsonValue>>& CollisionDisableTable = AssetData->GetArrayField(TEXT("CollisionDisableTable"));
+
+	/* Filled locally and moved in, instead of growing the asset's map pair by pair */
+	TMap<FRigidBodyIndexPair, bool> CollisionDisablePairs;
+	CollisionDisablePairs.Reserve(CollisionDisableTable.Num());
 
-	for (const TSharedPtr<FJsonValue> TableJSONElement : CollisionDisableTable) {
+	for (const TSharedPtr<FJsonValue>& TableJSONElement : CollisionDisableTable) {
 		const TSharedPtr<FJsonObject> TableObjectElement = TableJSONElement->AsObject();
 
-		bool MapValue = TableObjectElement->GetBoolField(TEXT("Value"));
-		TArray<TSharedPtr<FJsonValue>> Indices = TableObjectElement->GetObjectField(TEXT("Key"))->GetArrayField(TEXT("Indices"));
+		const bool MapValue = TableObjectElement->GetBoolField(TEXT("Value"));
+		const TArray<TSharedPtr<FJsonValue>>& Indices = TableObjectElement->GetObjectField(TEXT("Key"))->GetArrayField(TEXT("Indices"));
 
 		const int32 BodyIndexA = Indices[0]->AsNumber();
 		const int32 BodyIndexB = Indices[1]->AsNumber();
 
-		/* Add to the CollisionDisableTable */
-		PhysicsAsset->CollisionDisableTable.Add(FRigidBodyIndexPair(BodyIndexA, BodyIndexB), MapValue);
+		CollisionDisablePairs.Add(FRigidBodyIndexPair(BodyIndexA, BodyIndexB), MapValue);
 	}
 
+	PhysicsAsset->CollisionDisableTable = MoveTemp(CollisionDisablePairs);
+
 	/* ConstraintSetup ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-	ProcessJsonArrayField(AssetData, TEXT("ConstraintSetup"), [&](const TSharedPtr<FJsonObject>& ObjectField) {
-		const FName ExportName = GetExportNameOfSubobject(ObjectField->GetStringField(TEXT("ObjectName")));
-		const FJsonObject* ExportJson = Exports.Find(ExportName)->Json;
+	PhysicsAsset->ConstraintSetup.Reserve(ConstraintExports.Num());
 
-		TSharedPtr<FJsonObject> ExportProperties = ExportJson->GetObjectField(TEXT("Properties"));
-		UPhysicsConstraintTemplate* PhysicsConstraintTemplate = CreateNewConstraint(PhysicsAsset, ExportName);
+	for (const FPhysicsSubobjectExport& ConstraintExport : ConstraintExports) {
+		UPhysicsConstraintTemplate* PhysicsConstraintTemplate = CreateNewConstraint(PhysicsAsset, ConstraintExport.ExportName);
 		
-		GetObjectSerializer()->DeserializeObjectProperties(ExportProperties, PhysicsConstraintTemplate);
+		GetObjectSerializer()->DeserializeObjectProperties(ConstraintExport.Properties, PhysicsConstraintTemplate);
 
 		/* For caching. IMPORTANT! DO NOT REMOVE! */
 		PhysicsConstraintTemplate->UpdateProfileInstance();
-	});
+	}
 
 	/* Simple data at end ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 	GetObjectSerializer()->DeserializeObjectProperties(RemovePropertiesShared(AssetData,
@@ -93,15 +115,19 @@ bool IPhysicsAssetImporter::Import() {
 		}
 	}
 	
+	/* Finalize ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	PhysicsAsset->Modify();
+
+	/* For caching. IMPORTANT! DO NOT REMOVE! Rebuilt once now that every body exists, PostEditChange rebuilds both itself */
 	if (SkeletalMesh) {
 		PhysicsAsset->PreviewSkeletalMesh = SkeletalMesh;
 		PhysicsAsset->PostEditChange();
+	} else {
+		PhysicsAsset->UpdateBodySetupIndexMap();
+		PhysicsAsset->UpdateBoundsBodiesArray();
 	}
 
-	/* Finalize ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-	PhysicsAsset->Modify();
 	PhysicsAsset->MarkPackageDirty();
-	PhysicsAsset->UpdateBoundsBodiesArray();
 	
 	return OnAssetCreation(PhysicsAsset);
 }
@@ -3,97 +3,119 @@
 #include "Importers/Types/Tables/CurveTableImporter.h"
 #include "Dom/JsonObject.h"
 
-/* TODO: Rewrite? */
+/* Enum names resolved once, instead of searching the enum for every key */
+template <typename TEnum>
+class TCurveEnumTable {
+public:
+	TCurveEnumTable() {
+		const UEnum* Enum = StaticEnum<TEnum>();
+
+		/* The last entry is the generated _MAX */
+		for (int32 Index = 0; Index < Enum->NumEnums() - 1; Index++) {
+			Values.Add(Enum->GetNameStringByIndex(Index), Enum->GetValueByIndex(Index));
+			Values.Add(Enum->GetNameByIndex(Index).ToString(), Enum->GetValueByIndex(Index));
+		}
+	}
+
+	TEnum Find(const TSharedPtr<FJsonObject>& Object, const TCHAR* Field, const TEnum Default) const {
+		FString Name;
+		if (!Object->TryGetStringField(Field, Name)) return Default;
+
+		const int64* Value = Values.Find(Name);
+
+		return Value ? static_cast<TEnum>(*Value) : Default;
+	}
+
+private:
+	TMap<FString, int64> Values;
+};
 
 void CCurveTableDerived::ChangeTableMode(const ECurveTableMode Mode) {
 	CurveTableMode = Mode;
 }
 
+void CCurveTableDerived::ReserveRows(const int32 Num) {
+	RowMap.Reserve(Num);
+}
+
 bool ICurveTableImporter::Import() {
+	static const TCurveEnumTable<ECurveTableMode> TableModes;
+	static const TCurveEnumTable<ERichCurveInterpMode> InterpModes;
+	static const TCurveEnumTable<ERichCurveTangentMode> TangentModes;
+	static const TCurveEnumTable<ERichCurveTangentWeightMode> TangentWeightModes;
+	static const TCurveEnumTable<ERichCurveExtrapolation> Extrapolations;
+
 	TSharedPtr<FJsonObject> RowData = AssetData->GetObjectField(TEXT("Rows"));
 	UCurveTable* CurveTable = NewObject<UCurveTable>(Package, UCurveTable::StaticClass(), *AssetName, RF_Public | RF_Standalone);
 	CCurveTableDerived* DerivedCurveTable = Cast<CCurveTableDerived>(CurveTable);
 
-	/* Used to determine curve type */
-	ECurveTableMode CurveTableMode = ECurveTableMode::RichCurves; {
-		if (FString CurveMode; AssetData->TryGetStringField(TEXT("CurveTableMode"), CurveMode))
-			CurveTableMode = static_cast<ECurveTableMode>(StaticEnum<ECurveTableMode>()->GetValueByNameString(CurveMode));
+	/* One modification for the whole table */
+	CurveTable->Modify(true);
 
-		DerivedCurveTable->ChangeTableMode(CurveTableMode);
-	}
+	/* Used to determine curve type */
+	const ECurveTableMode CurveTableMode = TableModes.Find(AssetData, TEXT("CurveTableMode"), ECurveTableMode::RichCurves);
+	DerivedCurveTable->ChangeTableMode(CurveTableMode);
+	DerivedCurveTable->ReserveRows(RowData->Values.Num());
 
 	/* Loop throughout row data, and deserialize */
 	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : RowData->Values) {
 		const TSharedPtr<FJsonObject> CurveData = Pair.Value->AsObject();
 
-		/* Curve structure (either simple or rich) */
-		FRealCurve RealCurve;
+		const TArray<TSharedPtr<FJsonValue>>* Keys = nullptr;
+		CurveData->TryGetArrayField(TEXT("Keys"), Keys);
+
+		/* Keys are exported in order, they're written directly instead of inserted one by one */
+		FRealCurve* RealCurve;
 
 		if (CurveTableMode == ECurveTableMode::RichCurves) {
-			FRichCurve& NewRichCurve = CurveTable->AddRichCurve(FName(*Pair.Key)); {
-				RealCurve = static_cast<FRealCurve>(NewRichCurve);
-			}
+			FRichCurve& NewRichCurve = CurveTable->AddRichCurve(FName(*Pair.Key));
+			RealCurve = &NewRichCurve;
+
+			if (Keys != nullptr) {
+				NewRichCurve.Keys.Reserve(Keys->Num());
 
-			if (const TArray<TSharedPtr<FJsonValue>>* KeysPtr; CurveData->TryGetArrayField(TEXT("Keys"), KeysPtr))
-				for (const TSharedPtr<FJsonValue> KeyPtr : *KeysPtr) {
-					TSharedPtr<FJsonObject> Key = KeyPtr->AsObject();
-					NewRichCurve.AddKey(Key->GetNumberField(TEXT("Time")), Key->GetNumberField(TEXT("Value")));
-					FRichCurveKey RichKey = NewRichCurve.Keys.Last();
-
-					RichKey.InterpMode =
-						static_cast<ERichCurveInterpMode>(
-							StaticEnum<ERichCurveInterpMode>()->GetValueByNameString(Key->GetStringField(TEXT("InterpMode")))
-						);
-					RichKey.TangentMode =
-						static_cast<ERichCurveTangentMode>(
-							StaticEnum<ERichCurveTangentMode>()->GetValueByNameString(Key->GetStringField(TEXT("TangentMode")))
-						);
-					RichKey.TangentWeightMode =
-						static_cast<ERichCurveTangentWeightMode>(
-							StaticEnum<ERichCurveTangentWeightMode>()->GetValueByNameString(Key->GetStringField(TEXT("TangentWeightMode")))
-						);
-
-					RichKey.ArriveTangent = Key->GetNumberField(TEXT("ArriveTangent"));
-					RichKey.ArriveTangentWeight = Key->GetNumberField(TEXT("ArriveTangentWeight"));
-					RichKey.LeaveTangent = Key->GetNumberField(TEXT("LeaveTangent"));
-					RichKey.LeaveTangentWeight = Key->GetNumberField(TEXT("LeaveTangentWeight"));
+				for (const TSharedPtr<FJsonValue>& KeyValue : *Keys) {
+					const TSharedPtr<FJsonObject> Key = KeyValue->AsObject();
+
+					FRichCurveKey& RichKey = NewRichCurve.Keys.Emplace_GetRef(Key->GetNumberField(TEXT("Time")), Key->GetNumberField(TEXT("Value"))); {
+						RichKey.InterpMode = InterpModes.Find(Key, TEXT("InterpMode"), RCIM_Linear);
+						RichKey.TangentMode = TangentModes.Find(Key, TEXT("TangentMode"), RCTM_Auto);
+						RichKey.TangentWeightMode = TangentWeightModes.Find(Key, TEXT("TangentWeightMode"), RCTWM_WeightedNone);
+
+						RichKey.ArriveTangent = Key->GetNumberField(TEXT("ArriveTangent"));
+						RichKey.ArriveTangentWeight = Key->GetNumberField(TEXT("ArriveTangentWeight"));
+						RichKey.LeaveTangent = Key->GetNumberField(TEXT("LeaveTangent"));
+						RichKey.LeaveTangentWeight = Key->GetNumberField(TEXT("LeaveTangentWeight"));
+					}
 				}
-		} else {
-			FSimpleCurve& NewSimpleCurve = CurveTable->AddSimpleCurve(FName(*Pair.Key)); {
-				RealCurve = static_cast<FRealCurve>(NewSimpleCurve);
 			}
+		} else {
+			FSimpleCurve& NewSimpleCurve = CurveTable->AddSimpleCurve(FName(*Pair.Key));
+			RealCurve = &NewSimpleCurve;
 
 			/* Method of Interpolation */
-			NewSimpleCurve.InterpMode =
-				static_cast<ERichCurveInterpMode>(
-					StaticEnum<ERichCurveInterpMode>()->GetValueByNameString(CurveData->GetStringField(TEXT("InterpMode")))
-				);
-
-			if (const TArray<TSharedPtr<FJsonValue>>* KeysPtr; CurveData->TryGetArrayField(TEXT("Keys"), KeysPtr)) {
-				for (const TSharedPtr<FJsonValue> KeyPtr : *KeysPtr) {
-					TSharedPtr<FJsonObject> Key = KeyPtr->AsObject();
-					
-					NewSimpleCurve.AddKey(Key->GetNumberField(TEXT("Time")), Key->GetNumberField(TEXT("Value")));
+			NewSimpleCurve.InterpMode = InterpModes.Find(CurveData, TEXT("InterpMode"), RCIM_Linear);
+
+			if (Keys != nullptr) {
+				NewSimpleCurve.Keys.Reserve(Keys->Num());
+
+				for (const TSharedPtr<FJsonValue>& KeyValue : *Keys) {
+					const TSharedPtr<FJsonObject> Key = KeyValue->AsObject();
+
+					NewSimpleCurve.Keys.Emplace(Key->GetNumberField(TEXT("Time")), Key->GetNumberField(TEXT("Value")));
 				}
 			}
 		}
 
 		/* Inherited data from FRealCurve */
-		RealCurve.SetDefaultValue(CurveData->GetNumberField(TEXT("DefaultValue")));
-		RealCurve.PreInfinityExtrap = 
-			static_cast<ERichCurveExtrapolation>(
-				StaticEnum<ERichCurveExtrapolation>()->GetValueByNameString(CurveData->GetStringField(TEXT("PreInfinityExtrap")))
-			);
-		RealCurve.PostInfinityExtrap =
-			static_cast<ERichCurveExtrapolation>(
-				StaticEnum<ERichCurveExtrapolation>()->GetValueByNameString(CurveData->GetStringField(TEXT("PostInfinityExtrap")))
-			);
-
-		/* Update Curve Table */
-		CurveTable->OnCurveTableChanged().Broadcast();
-		CurveTable->Modify(true);
+		RealCurve->SetDefaultValue(CurveData->GetNumberField(TEXT("DefaultValue")));
+		RealCurve->PreInfinityExtrap = Extrapolations.Find(CurveData, TEXT("PreInfinityExtrap"), RCCE_Constant);
+		RealCurve->PostInfinityExtrap = Extrapolations.Find(CurveData, TEXT("PostInfinityExtrap"), RCCE_Constant);
 	}
 
+	/* Listeners (e.g. open editors) only update once */
+	CurveTable->OnCurveTableChanged().Broadcast();
+
 	/* Handle edit changes, and add it to the content browser */
 	return OnAssetCreation(CurveTable);
-}
\ No newline at end of file
+}
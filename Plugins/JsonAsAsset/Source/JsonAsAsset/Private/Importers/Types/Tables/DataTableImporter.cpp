@@ -2,8 +2,18 @@
 
 #include "Importers/Types/Tables/DataTableImporter.h"
 
+#include "Utilities/ImportTrace.h"
+
+#include "Async/ParallelFor.h"
+
 bool IDataTableImporter::Import() {
-	UDataTable* DataTable = NewObject<UDataTable>(Package, UDataTable::StaticClass(), *AssetName, RF_Public | RF_Standalone);
+	/* Reimport over the existing table, only touching rows that changed */
+	UDataTable* DataTable = Cast<UDataTable>(FindAssetForDeltaReimport(UDataTable::StaticClass()));
+	bool bReimport = DataTable != nullptr;
+
+	if (!bReimport) {
+		DataTable = NewObject<UDataTable>(Package, UDataTable::StaticClass(), *AssetName, RF_Public | RF_Standalone);
+	}
 	
 	/* ScriptClass for the Data Table */
 	FString TableStruct; {
@@ -33,6 +43,12 @@ bool IDataTableImporter::Import() {
 
 			return false;
 		}
+
+		/* A different row struct means every row changes */
+		if (bReimport && DataTable->RowStruct != TableRowStruct) {
+			DataTable->EmptyTable();
+			bReimport = false;
+		}
 		
 		DataTable->RowStruct = TableRowStruct;
 	}
@@ -41,14 +57,102 @@ bool IDataTableImporter::Import() {
 	const UPropertySerializer* ObjectPropertySerializer = GetObjectSerializer()->GetPropertySerializer();
 	const TSharedPtr<FJsonObject> RowData = AssetData->GetObjectField(TEXT("Rows"));
 
-	/* Loop throughout row data, and deserialize */
-	for (TPair<FString, TSharedPtr<FJsonValue>>& Pair : RowData->Values) {
-		const TSharedPtr<FStructOnScope> ScopedStruct = MakeShareable(new FStructOnScope(TableRowStruct));
-		TSharedPtr<FJsonObject> StructData = Pair.Value->AsObject();
+	bool bChanged = false;
+
+	/* Rows that no longer exist in the json */
+	if (bReimport) {
+		for (const FName& RowName : DataTable->GetRowNames()) {
+			if (!RowData->HasField(RowName.ToString())) {
+				DataTable->RemoveRow(RowName);
+				bChanged = true;
+			}
+		}
+	}
+
+	TArray<FName> RowNames;
+	TArray<TSharedPtr<FJsonObject>> RowObjects;
+	RowNames.Reserve(RowData->Values.Num());
+	RowObjects.Reserve(RowData->Values.Num());
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : RowData->Values) {
+		RowNames.Add(*Pair.Key);
+		RowObjects.Add(Pair.Value->AsObject());
+	}
+
+	/*
+	 * Rows are decoded straight into their final memory: the table's own rows for a new
+	 * table, one block of scratch rows when reimporting (those are compared first).
+	 */
+	const int32 RowSize = TableRowStruct->GetStructureSize();
+	TArray<uint8*> Rows;
+	Rows.SetNumUninitialized(RowNames.Num());
+
+	uint8* ScratchRows = nullptr;
+
+	if (bReimport) {
+		ScratchRows = static_cast<uint8*>(FMemory::Malloc(FMath::Max(RowSize * RowNames.Num(), 1), TableRowStruct->GetMinAlignment()));
+
+		for (int32 Index = 0; Index < RowNames.Num(); Index++) {
+			Rows[Index] = ScratchRows + RowSize * Index;
+			TableRowStruct->InitializeStruct(Rows[Index]);
+		}
+	} else {
+		/* Allocated with default values, filled in place below */
+		const FStructOnScope DefaultRow(TableRowStruct);
+
+		for (int32 Index = 0; Index < RowNames.Num(); Index++) {
+			DataTable->AddRow(RowNames[Index], *reinterpret_cast<const FTableRowBase*>(DefaultRow.GetStructMemory()));
+			Rows[Index] = DataTable->FindRowUnchecked(RowNames[Index]);
+		}
+	}
+
+	/* Deserialize every row, on every core when rows never look up other objects */
+	{
+		JSONASASSET_TRACE_SCOPE("DeserializeRows", DeserializeProperties)
+
+		auto DeserializeRow = [&](const int32 Index) {
+			ObjectPropertySerializer->DeserializeStruct(TableRowStruct, RowObjects[Index].ToSharedRef(), Rows[Index]);
+		};
+
+		if (ObjectPropertySerializer->IsPlainDataStruct(TableRowStruct)) {
+			ParallelFor(Rows.Num(), DeserializeRow);
+		} else {
+			for (int32 Index = 0; Index < Rows.Num(); Index++) {
+				DeserializeRow(Index);
+			}
+		}
+	}
+
+	if (bReimport) {
+		for (int32 Index = 0; Index < Rows.Num(); Index++) {
+			uint8* ExistingRow = DataTable->FindRowUnchecked(RowNames[Index]);
+
+			/* Identical rows are left alone, changed rows are copied over in place */
+			if (ExistingRow != nullptr) {
+				if (TableRowStruct->CompareScriptStruct(ExistingRow, Rows[Index], PPF_None)) {
+					continue;
+				}
+
+				TableRowStruct->CopyScriptStruct(ExistingRow, Rows[Index]);
+			} else {
+				DataTable->AddRow(RowNames[Index], *reinterpret_cast<const FTableRowBase*>(Rows[Index]));
+			}
+
+			bChanged = true;
+		}
+
+		for (uint8* Row : Rows) {
+			TableRowStruct->DestroyStruct(Row);
+		}
+
+		FMemory::Free(ScratchRows);
+	} else {
+		bChanged = true;
+	}
 
-		/* Deserialize, add row */
-		ObjectPropertySerializer->DeserializeStruct(TableRowStruct, StructData.ToSharedRef(), ScopedStruct->GetStructMemory());
-		DataTable->AddRow(*Pair.Key, *reinterpret_cast<const FTableRowBase*>(ScopedStruct->GetStructMemory()));
+	/* Change notifications and PostEditChange only run once, for the whole table */
+	if (bReimport) {
+		return OnAssetReimport(DataTable, bChanged);
 	}
 
 	/* Handle edit changes, and add it to the content browser */
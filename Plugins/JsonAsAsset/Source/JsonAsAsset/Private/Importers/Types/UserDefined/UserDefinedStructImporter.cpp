@@ -43,9 +43,11 @@ bool IUserDefinedStructImporter::Import() {
 
     /* Struct Metadata [Editor Only Data] */
     CookedStructMetaData = GetExport("StructCookedMetaData", AllJsonObjects, true);
+    PropertiesMetaData.Empty();
     
     if (CookedStructMetaData.IsValid() && CookedStructMetaData->HasField(TEXT("StructMetaData"))) {
-        TArray<TSharedPtr<FJsonValue>> ObjectMetaData = CookedStructMetaData->GetObjectField(TEXT("StructMetaData"))->GetObjectField(TEXT("ObjectMetaData"))->GetArrayField(TEXT("ObjectMetaData"));
+        const TSharedPtr<FJsonObject> StructMetaData = CookedStructMetaData->GetObjectField(TEXT("StructMetaData"));
+        TArray<TSharedPtr<FJsonValue>> ObjectMetaData = StructMetaData->GetObjectField(TEXT("ObjectMetaData"))->GetArrayField(TEXT("ObjectMetaData"));
 
         for (const TSharedPtr<FJsonValue> ObjectMetadataValue : ObjectMetaData) {
             const TSharedPtr<FJsonObject> ObjectMetadataObject = ObjectMetadataValue->AsObject();
@@ -60,26 +62,51 @@ bool IUserDefinedStructImporter::Import() {
                 FStructureEditorUtils::ChangeTooltip(UserDefinedStruct, MetadataValue);
             }
         }
+
+        /* Index each property's metadata by its name, instead of scanning the array per property */
+        for (const TSharedPtr<FJsonValue>& Value : StructMetaData->GetArrayField(TEXT("PropertiesMetaData"))) {
+            const TSharedPtr<FJsonObject> PropertiesMetadataJsonObject = Value->AsObject();
+
+            PropertiesMetaData.Add(PropertiesMetadataJsonObject->GetStringField(TEXT("Key")), PropertiesMetadataJsonObject->GetObjectField(TEXT("Value")));
+        }
     }
     
     /* Remove default variable */
     FStructureEditorUtils::GetVarDesc(UserDefinedStruct).Pop();
 
     const TArray<TSharedPtr<FJsonValue>> ChildProperties = AssetData->GetArrayField(TEXT("ChildProperties"));
+
+    /* Add every variable first, the struct is only compiled once they're all in */
+    TArray<FString> PropertyNames;
+    PropertyNames.Reserve(ChildProperties.Num());
     
     for (const TSharedPtr<FJsonValue> Property : ChildProperties) {
-        const TSharedPtr<FJsonObject> PropertyObject = Property->AsObject();
-        
-        ImportPropertyIntoStruct(UserDefinedStruct, PropertyObject);
+        PropertyNames.Add(AddPropertyDescription(UserDefinedStruct, Property->AsObject()));
+    }
+
+    FStructureEditorUtils::OnStructureChanged(UserDefinedStruct, FStructureEditorUtils::EStructureEditorChangeInfo::AddedVariable);
+
+    /* Default values are deserialized into a single instance of the compiled struct */
+    FStructOnScope StructScope(UserDefinedStruct);
+
+    for (int32 Index = 0; Index < PropertyNames.Num(); Index++) {
+        ApplyPropertyDefaults(UserDefinedStruct, FStructureEditorUtils::GetVarDesc(UserDefinedStruct)[Index], PropertyNames[Index], StructScope.GetStructMemory());
+    }
+
+    /* Recompile once more so the default instance picks up every default value */
+    FStructureEditorUtils::OnStructureChanged(UserDefinedStruct, FStructureEditorUtils::EStructureEditorChangeInfo::DefaultValueChanged);
+
+    /* Properties are recreated on compile, so their metadata is set last */
+    for (const FString& Name : PropertyNames) {
+        ApplyPropertyMetaData(UserDefinedStruct, Name);
     }
 
     /* Handle edit changes, and add it to the content browser */
     return OnAssetCreation(UserDefinedStruct);
 }
 
-void IUserDefinedStructImporter::ImportPropertyIntoStruct(UUserDefinedStruct* UserDefinedStruct, const TSharedPtr<FJsonObject> &PropertyJsonObject) {
+FString IUserDefinedStructImporter::AddPropertyDescription(UUserDefinedStruct* UserDefinedStruct, const TSharedPtr<FJsonObject> &PropertyJsonObject) {
     const FString Name = PropertyJsonObject->GetStringField(TEXT("Name"));
-    const FString Type = PropertyJsonObject->GetStringField(TEXT("Type"));
 
     FString FieldDisplayName = Name;
     FGuid FieldGuid;
@@ -103,24 +130,39 @@ void IUserDefinedStructImporter::ImportPropertyIntoStruct(UUserDefinedStruct* Us
         Variable.SetPinType(ResolvePropertyPinType(PropertyJsonObject));
     }
 
+    /* Editor Only Data */
+    if (const TSharedPtr<FJsonObject>* PropertyMetaData = PropertiesMetaData.Find(Name)) {
+        for (const TSharedPtr<FJsonValue>& FieldValue : (*PropertyMetaData)->GetArrayField(TEXT("FieldMetaData"))) {
+            const TSharedPtr<FJsonObject> FieldObject = FieldValue->AsObject();
+
+            const FString MetadataKey = FieldObject->GetStringField(TEXT("Key"));
+
+            if (MetadataKey == TEXT("Tooltip")) {
+                Variable.ToolTip = FieldObject->GetStringField(TEXT("Value"));
+            }
+
+            if (MetadataKey == TEXT("DisplayName")) {
+                Variable.FriendlyName = FieldObject->GetStringField(TEXT("Value"));
+            }
+        }
+    }
+
     FStructureEditorUtils::GetVarDesc(UserDefinedStruct).Add(Variable);
-    FStructureEditorUtils::OnStructureChanged(UserDefinedStruct, FStructureEditorUtils::EStructureEditorChangeInfo::AddedVariable);
 
-    const TSharedPtr<FJsonValue>& PropertyJsonValue = DefaultProperties->Values.FindChecked(Name);
+    return Name;
+}
 
+void IUserDefinedStructImporter::ApplyPropertyDefaults(UUserDefinedStruct* UserDefinedStruct, FStructVariableDescription& Variable, const FString& Name, uint8* InstanceMemory) const {
+    const TSharedPtr<FJsonValue>* PropertyJsonValue = DefaultProperties->Values.Find(Name);
     FProperty* Property = FindFProperty<FProperty>(UserDefinedStruct, *Name);
 
-    if (Property == nullptr) {
+    if (PropertyJsonValue == nullptr || Property == nullptr) {
         return;
     }
 
-    /* DefaultProperties ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-    FStructOnScope StructScope(UserDefinedStruct);
-    uint8* InstanceMemory = StructScope.GetStructMemory();
-
     /* Get Property Value and deserialize the values */
     void* PropertyValue = Property->ContainerPtrToValuePtr<void>(InstanceMemory);
-    PropertySerializer->DeserializePropertyValue(Property, PropertyJsonValue.ToSharedRef(), PropertyValue);
+    PropertySerializer->DeserializePropertyValue(Property, PropertyJsonValue->ToSharedRef(), PropertyValue);
 
     /* Get the default value as a string */
     FString DefaultValue;
@@ -130,38 +172,22 @@ void IUserDefinedStructImporter::ImportPropertyIntoStruct(UUserDefinedStruct* Us
     Property->ExportText_Direct(DefaultValue, PropertyValue, nullptr, UserDefinedStruct, 0);
 #endif
 
-    /* Update the variable */
-    FStructureEditorUtils::ChangeVariableDefaultValue(UserDefinedStruct, Variable.VarGuid, DefaultValue);
-
-    /* Editor Only Data */
-    if (CookedStructMetaData.IsValid() && CookedStructMetaData->HasField(TEXT("StructMetaData"))) {
-        TArray<TSharedPtr<FJsonValue>> PropertiesMetaData = CookedStructMetaData->GetObjectField(TEXT("StructMetaData"))->GetArrayField(TEXT("PropertiesMetaData"));
-        
-        for (const TSharedPtr<FJsonValue> Value : PropertiesMetaData) {
-            const TSharedPtr<FJsonObject> PropertiesMetadataJsonObject = Value->AsObject();
-
-            /* Find a matching key */
-            if (PropertiesMetadataJsonObject->GetStringField(TEXT("Key")) == Name) {
-                TArray<TSharedPtr<FJsonValue>> FieldMetaData = PropertiesMetadataJsonObject->GetObjectField(TEXT("Value"))->GetArrayField(TEXT("FieldMetaData"));
-
-                for (const TSharedPtr<FJsonValue> FieldValue : FieldMetaData) {
-                    const TSharedPtr<FJsonObject> FieldObject = FieldValue->AsObject();
+    /* Written directly, ChangeVariableDefaultValue would recompile the struct for every variable */
+    Variable.DefaultValue = DefaultValue;
+}
 
-                    FString MetadataKey = FieldObject->GetStringField(TEXT("Key"));
-                    FString MetadataValue = FieldObject->GetStringField(TEXT("Value"));
+void IUserDefinedStructImporter::ApplyPropertyMetaData(UUserDefinedStruct* UserDefinedStruct, const FString& Name) const {
+    const TSharedPtr<FJsonObject>* PropertyMetaData = PropertiesMetaData.Find(Name);
+    FProperty* Property = FindFProperty<FProperty>(UserDefinedStruct, *Name);
 
-                    Property->SetMetaData(FName(*MetadataKey), *MetadataValue);
+    if (PropertyMetaData == nullptr || Property == nullptr) {
+        return;
+    }
 
-                    if (MetadataKey == TEXT("Tooltip")) {
-                        FStructureEditorUtils::ChangeVariableTooltip(UserDefinedStruct, Variable.VarGuid, MetadataValue);
-                    }
+    for (const TSharedPtr<FJsonValue>& FieldValue : (*PropertyMetaData)->GetArrayField(TEXT("FieldMetaData"))) {
+        const TSharedPtr<FJsonObject> FieldObject = FieldValue->AsObject();
 
-                    if (MetadataKey == TEXT("DisplayName")) {
-                        Variable.FriendlyName = MetadataValue;
-                    }
-                }
-            }
-        }
+        Property->SetMetaData(FName(*FieldObject->GetStringField(TEXT("Key"))), *FieldObject->GetStringField(TEXT("Value")));
     }
 }
 
@@ -27,9 +27,12 @@
 #include "Modules/Tools/SkeletalMeshData.h"
 
 #include "Modules/UI/CommandsModule.h"
+#include "Modules/UI/ImportReportPanel.h"
 #include "Modules/UI/StyleModule.h"
 #include "Toolbar/Toolbar.h"
 #include "Utilities/Compatibility.h"
+#include "Utilities/ImportHashCache.h"
+#include "Utilities/TypeResolver.h"
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
 #ifdef _MSC_VER
@@ -72,6 +75,14 @@ void FJsonAsAssetModule::StartupModule() {
 
 	Plugin = IPluginManager::Get().FindPlugin("JsonAsAsset");
 
+	/* Cached type lookups are dropped when modules change or code is reloaded */
+	FTypeResolver::Initialize();
+
+	/* Deleted or renamed assets are always imported again */
+	FImportHashCache::Initialize();
+
+	SImportReportPanel::RegisterTab();
+
 	GJsonAsAssetVersioning.Update();
 
 	/* Update ExportDirectory if empty */
@@ -89,6 +100,11 @@ void FJsonAsAssetModule::ShutdownModule() {
 	FJsonAsAssetStyle::Shutdown();
 	FJsonAsAssetCommands::Unregister();
 
+	FTypeResolver::Shutdown();
+	FImportHashCache::Shutdown();
+
+	SImportReportPanel::UnregisterTab();
+
 	/* Unregister message log listing if the module is loaded */
 	if (FModuleManager::Get().IsModuleLoaded("MessageLog")) {
 		FMessageLogModule& MessageLogModule = FModuleManager::GetModuleChecked<FMessageLogModule>("MessageLog");
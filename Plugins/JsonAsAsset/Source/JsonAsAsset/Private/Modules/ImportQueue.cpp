@@ -0,0 +1,197 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Modules/ImportQueue.h"
+
+#include "Importers/Constructor/Importer.h"
+#include "Modules/LogCategory.h"
+#include "Modules/UI/ImportReportPanel.h"
+#include "Settings/JsonAsAssetSettings.h"
+#include "Utilities/EngineUtilities.h"
+#include "Utilities/ImportMemory.h"
+#include "Utilities/ImportReport.h"
+#include "Utilities/MaterialCompileBatch.h"
+
+#include "Containers/Ticker.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+namespace {
+	TArray<FString> GPendingFiles;
+	int32 GNextFile = 0;
+
+	/* The file being imported, an export at a time */
+	TUniquePtr<FExportsImport> GCurrentFile;
+
+	bool GCancelRequested = false;
+	double GStartTime = 0.0;
+
+#if ENGINE_UE5
+	FTSTicker::FDelegateHandle GTickerHandle;
+#else
+	FDelegateHandle GTickerHandle;
+#endif
+
+	TWeakPtr<SNotificationItem> GProgressNotification;
+}
+
+void FImportQueue::Enqueue(const TArray<FString>& Files) {
+	GPendingFiles.Append(Files);
+
+	if (IsRunning()) {
+		UpdateNotification();
+
+		return;
+	}
+
+	GCancelRequested = false;
+	GStartTime = FPlatformTime::Seconds();
+	FImportMemory::ResetPeakMemory();
+
+	/* Assets don't notify individually during a session, this notification is the only progress shown */
+	FImportReport::BeginSession();
+
+	/* Materials compile once, after every file of the queue */
+	FMaterialCompileBatch::Begin();
+
+	FNotificationInfo Info(FText::FromString("Importing..."));
+	Info.bFireAndForget = false;
+	Info.bUseThrobber = true;
+	Info.ExpireDuration = 5.0f;
+	Info.WidthOverride = FOptionalSize(350);
+	Info.ButtonDetails.Add(FNotificationButtonInfo(
+		FText::FromString("Cancel"),
+		FText::FromString("Stop importing after the current asset"),
+		FSimpleDelegate::CreateStatic(&FImportQueue::Cancel),
+		SNotificationItem::CS_Pending
+	));
+
+	const TSharedPtr<SNotificationItem> Notification = FSlateNotificationManager::Get().AddNotification(Info);
+
+	if (Notification.IsValid()) {
+		Notification->SetCompletionState(SNotificationItem::CS_Pending);
+	}
+
+	GProgressNotification = Notification;
+
+	UpdateNotification();
+
+#if ENGINE_UE5
+	GTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FImportQueue::Tick));
+#else
+	GTickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FImportQueue::Tick));
+#endif
+}
+
+void FImportQueue::Cancel() {
+	if (!IsRunning()) return;
+
+	GCancelRequested = true;
+
+	if (const TSharedPtr<SNotificationItem> Notification = GProgressNotification.Pin()) {
+		Notification->SetText(FText::FromString("Cancelling..."));
+	}
+}
+
+bool FImportQueue::IsRunning() {
+	return GTickerHandle.IsValid();
+}
+
+bool FImportQueue::Tick(float DeltaTime) {
+	const UJsonAsAssetSettings* Settings = GetSettings();
+	const double Budget = FMath::Max(Settings->AssetSettings.ImportFrameBudgetMs, 1) / 1000.0;
+	const double FrameStart = FPlatformTime::Seconds();
+
+	/* At least one export (or reading a file) per frame, then keep going while there's budget left */
+	do {
+		if (GCancelRequested || (!GCurrentFile.IsValid() && GNextFile >= GPendingFiles.Num())) {
+			Finish();
+
+			return false;
+		}
+
+		if (!GCurrentFile.IsValid()) {
+			EmptyMessageLog();
+
+			GCurrentFile = IImporter::BeginImportReference(GPendingFiles[GNextFile++]);
+
+			/* Couldn't be parsed, already reported */
+			if (!GCurrentFile.IsValid()) {
+				FImportMemory::TrimBetweenFiles();
+			}
+		} else if (!GCurrentFile->ImportNext()) {
+			GCurrentFile.Reset();
+
+			FImportMemory::TrimBetweenFiles();
+		}
+	} while (FPlatformTime::Seconds() - FrameStart < Budget);
+
+	UpdateNotification();
+
+	return true;
+}
+
+void FImportQueue::Finish() {
+	/* A file cancelled part way through isn't counted */
+	const int32 Imported = GNextFile - (GCurrentFile.IsValid() ? 1 : 0);
+	GCurrentFile.Reset();
+
+	const int32 Total = GPendingFiles.Num();
+	const bool bCancelled = GCancelRequested && Imported < Total;
+
+	UE_LOG(LogJsonAsAsset, Log, TEXT("%s %d of %d files in %.2f seconds, peak memory %.1f MB"),
+		bCancelled ? TEXT("Cancelled import after") : TEXT("Imported"),
+		Imported, Total, FPlatformTime::Seconds() - GStartTime, FImportMemory::GetPeakMemory() / (1024.0 * 1024.0));
+
+	const double CompileSeconds = FMaterialCompileBatch::End();
+
+	if (CompileSeconds > 0.0) {
+		UE_LOG(LogJsonAsAsset, Log, TEXT("Material compilation took %.2f seconds"), CompileSeconds);
+	}
+
+	FImportReport::EndSession();
+
+	const TSharedPtr<const FImportReportData> Report = FImportReport::GetLastReport();
+	const int32 FailedAssets = Report.IsValid() ? Report->Count(EImportReportStatus::Failed) : 0;
+
+	if (const TSharedPtr<SNotificationItem> Notification = GProgressNotification.Pin()) {
+		Notification->SetText(FText::FromString(bCancelled
+			? FString::Printf(TEXT("Import cancelled (%d of %d files)"), Imported, Total)
+			: FString::Printf(TEXT("Imported %d files"), Imported)
+		));
+
+#if ENGINE_UE5
+		if (Report.IsValid()) {
+			Notification->SetSubText(FText::FromString(FString::Printf(TEXT("%d assets imported, %d failed, %d skipped"),
+				Report->Count(EImportReportStatus::Imported), FailedAssets, Report->Count(EImportReportStatus::Skipped))));
+		}
+#endif
+
+		Notification->SetHyperlink(FSimpleDelegate::CreateStatic(&SImportReportPanel::Open), FText::FromString("Open Import Report"));
+		Notification->SetCompletionState(bCancelled || FailedAssets > 0 ? SNotificationItem::CS_Fail : SNotificationItem::CS_Success);
+		Notification->ExpireAndFadeout();
+	}
+
+	GProgressNotification.Reset();
+	GPendingFiles.Empty();
+	GNextFile = 0;
+	GCancelRequested = false;
+
+	/* Returning false from the tick removes the ticker */
+	GTickerHandle.Reset();
+}
+
+void FImportQueue::UpdateNotification() {
+	const TSharedPtr<SNotificationItem> Notification = GProgressNotification.Pin();
+	if (!Notification.IsValid() || GCancelRequested) return;
+
+	/* The file being imported, or the next one to read */
+	const int32 CurrentFile = GCurrentFile.IsValid() ? GNextFile - 1 : GNextFile;
+
+	Notification->SetText(FText::FromString(FString::Printf(TEXT("Importing %d of %d files..."), FMath::Min(CurrentFile + 1, GPendingFiles.Num()), GPendingFiles.Num())));
+
+#if ENGINE_UE5
+	if (GPendingFiles.IsValidIndex(CurrentFile)) {
+		Notification->SetSubText(FText::FromString(FPaths::GetBaseFilename(GPendingFiles[CurrentFile])));
+	}
+#endif
+}
@@ -0,0 +1,44 @@
+﻿/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Modules/Tools/PreflightAnalysis.h"
+
+#include "Modules/LogCategory.h"
+#include "Utilities/EngineUtilities.h"
+#include "Utilities/ImportPreflight.h"
+
+void FToolPreflightAnalysis::Execute() {
+	const UJsonAsAssetSettings* Settings = GetSettings();
+
+	const FString Directory = OpenFolderDialog("Select a folder of exports to analyze", Settings->ExportDirectory.Path);
+	if (Directory.IsEmpty()) {
+		return;
+	}
+
+	const FImportPreflightReport Report = FImportPreflight::AnalyzeDirectory(Directory);
+	const FString ReportPath = FImportPreflight::SaveReport(Report);
+
+	UE_LOG(LogJsonAsAsset, Log, TEXT("Preflight report (%s)\n%s"), *ReportPath, *Report.ToString());
+
+	EmptyMessageLog();
+
+	FMessageLog MessageLog = GetMessageLog();
+	TArray<FString> Lines;
+	Report.ToString().ParseIntoArrayLines(Lines);
+
+	for (const FString& Line : Lines) {
+		MessageLog.Message(EMessageSeverity::Info, FText::FromString(Line));
+	}
+
+	MessageLog.Message(EMessageSeverity::Info, FText::FromString("Report saved to " + ReportPath));
+
+	AppendNotification(
+		FText::FromString("Preflight Analysis"),
+		FText::FromString(FString::Printf(TEXT("%d of %d exports importable, estimated %.0f seconds"), Report.ImportableExports, Report.Exports, Report.EstimatedSeconds)),
+		5.0f,
+		SNotificationItem::CS_Success,
+		true,
+		400.0f
+	);
+
+	OpenMessageLog();
+}
@@ -0,0 +1,294 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Modules/UI/ImportReportPanel.h"
+
+#include "Utilities/Compatibility.h"
+
+#include "Framework/Docking/TabManager.h"
+#include "Widgets/Docking/SDockTab.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Layout/SBorder.h"
+#include "Widgets/Layout/SScrollBox.h"
+#include "Widgets/Layout/SSplitter.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/SHeaderRow.h"
+
+#define LOCTEXT_NAMESPACE "SImportReportPanel"
+
+const FName SImportReportPanel::TabName = TEXT("JsonAsAssetImportReport");
+
+namespace ImportReportColumns {
+	const FName Status = TEXT("Status");
+	const FName Name = TEXT("Name");
+	const FName Type = TEXT("Type");
+	const FName Seconds = TEXT("Seconds");
+	const FName Reason = TEXT("Reason");
+}
+
+/* One asset of the report */
+class SImportReportRow : public SMultiColumnTableRow<TSharedPtr<FImportReportEntry>> {
+public:
+	SLATE_BEGIN_ARGS(SImportReportRow) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& OwnerTable, const TSharedPtr<FImportReportEntry>& InEntry) {
+		Entry = InEntry;
+
+		SMultiColumnTableRow::Construct(FSuperRowType::FArguments(), OwnerTable);
+	}
+
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override {
+		FString Text;
+
+		if (ColumnName == ImportReportColumns::Status) Text = FImportReport::StatusToString(Entry->Status);
+		else if (ColumnName == ImportReportColumns::Name) Text = Entry->Name;
+		else if (ColumnName == ImportReportColumns::Type) Text = Entry->Type;
+		else if (ColumnName == ImportReportColumns::Seconds) Text = FString::Printf(TEXT("%.3f"), Entry->Seconds);
+		else if (ColumnName == ImportReportColumns::Reason) Text = Entry->Reason;
+
+		FSlateColor Color = FSlateColor::UseForeground();
+
+		if (ColumnName == ImportReportColumns::Status) {
+			if (Entry->Status == EImportReportStatus::Failed) Color = FLinearColor(0.9f, 0.2f, 0.2f);
+			if (Entry->Status == EImportReportStatus::Skipped) Color = FSlateColor::UseSubduedForeground();
+		}
+
+		return SNew(STextBlock)
+			.Text(FText::FromString(Text))
+			.ToolTipText(FText::FromString(Entry->Package))
+			.ColorAndOpacity(Color);
+	}
+
+private:
+	TSharedPtr<FImportReportEntry> Entry;
+};
+
+void SImportReportPanel::RegisterTab() {
+	FGlobalTabmanager::Get()->RegisterNomadTabSpawner(TabName, FOnSpawnTab::CreateLambda([](const FSpawnTabArgs&) {
+		return SNew(SDockTab)
+			.TabRole(ETabRole::NomadTab)
+			[
+				SNew(SImportReportPanel)
+			];
+	}))
+	.SetDisplayName(LOCTEXT("TabTitle", "Import Report"))
+	.SetTooltipText(LOCTEXT("TabTooltip", "Results of the last JsonAsAsset import"))
+	.SetMenuType(ETabSpawnerMenuType::Hidden);
+}
+
+void SImportReportPanel::UnregisterTab() {
+	if (FSlateApplication::IsInitialized()) {
+		FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(TabName);
+	}
+}
+
+void SImportReportPanel::Open() {
+	FGlobalTabmanager::Get()->TryInvokeTab(TabName);
+}
+
+void SImportReportPanel::Construct(const FArguments& InArgs) {
+	ReportUpdatedHandle = FImportReport::OnReportUpdated().AddSP(this, &SImportReportPanel::Refresh);
+
+	auto MakeFilter = [this](const FText& Label, bool SImportReportPanel::* Flag) {
+		return SNew(SCheckBox)
+			.IsChecked_Lambda([this, Flag]() { return this->*Flag ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+			.OnCheckStateChanged_Lambda([this, Flag](const ECheckBoxState State) {
+				this->*Flag = State == ECheckBoxState::Checked;
+				RefreshEntries();
+			})
+			[
+				SNew(STextBlock).Text(Label)
+			];
+	};
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(4.0f)
+		[
+			SNew(SHorizontalBox)
+
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock).Text(this, &SImportReportPanel::GetSummaryText)
+			]
+
+			+ SHorizontalBox::Slot().AutoWidth().Padding(8.0f, 0.0f, 0.0f, 0.0f)
+			[
+				MakeFilter(LOCTEXT("ShowImported", "Imported"), &SImportReportPanel::bShowImported)
+			]
+
+			+ SHorizontalBox::Slot().AutoWidth().Padding(8.0f, 0.0f, 0.0f, 0.0f)
+			[
+				MakeFilter(LOCTEXT("ShowFailed", "Failed"), &SImportReportPanel::bShowFailed)
+			]
+
+			+ SHorizontalBox::Slot().AutoWidth().Padding(8.0f, 0.0f, 0.0f, 0.0f)
+			[
+				MakeFilter(LOCTEXT("ShowSkipped", "Skipped"), &SImportReportPanel::bShowSkipped)
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		[
+			SNew(SSplitter)
+			.Orientation(Orient_Vertical)
+
+			+ SSplitter::Slot()
+			.Value(0.7f)
+			[
+				SAssignNew(ListView, SListView<TSharedPtr<FImportReportEntry>>)
+				.ListItemsSource(&VisibleEntries)
+				.OnGenerateRow(this, &SImportReportPanel::GenerateRow)
+				.HeaderRow(
+					SNew(SHeaderRow)
+					+ SHeaderRow::Column(ImportReportColumns::Status).DefaultLabel(LOCTEXT("Status", "Status")).FillWidth(0.1f)
+					+ SHeaderRow::Column(ImportReportColumns::Name).DefaultLabel(LOCTEXT("Name", "Name")).FillWidth(0.3f)
+					+ SHeaderRow::Column(ImportReportColumns::Type).DefaultLabel(LOCTEXT("Type", "Type")).FillWidth(0.15f)
+					+ SHeaderRow::Column(ImportReportColumns::Seconds).DefaultLabel(LOCTEXT("Seconds", "Seconds")).FillWidth(0.1f)
+					+ SHeaderRow::Column(ImportReportColumns::Reason).DefaultLabel(LOCTEXT("Reason", "Reason")).FillWidth(0.35f)
+				)
+			]
+
+			+ SSplitter::Slot()
+			.Value(0.3f)
+			[
+				SNew(SBorder)
+				.BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
+				[
+					SNew(SScrollBox)
+
+					+ SScrollBox::Slot()
+					.Padding(4.0f)
+					[
+						SNew(STextBlock)
+						.Text(this, &SImportReportPanel::GetDetailsText)
+						.AutoWrapText(true)
+					]
+				]
+			]
+		]
+	];
+
+	Refresh();
+}
+
+SImportReportPanel::~SImportReportPanel() {
+	FImportReport::OnReportUpdated().Remove(ReportUpdatedHandle);
+}
+
+void SImportReportPanel::Refresh() {
+	Report = FImportReport::GetLastReport();
+
+	/* Bound as attributes, built once per report instead of every frame */
+	SummaryText = BuildSummaryText();
+	DetailsText = BuildDetailsText();
+
+	RefreshEntries();
+}
+
+void SImportReportPanel::RefreshEntries() {
+	VisibleEntries.Reset();
+
+	if (Report.IsValid()) {
+		for (const TSharedPtr<FImportReportEntry>& Entry : Report->Entries) {
+			const bool bVisible =
+				(Entry->Status == EImportReportStatus::Imported && bShowImported) ||
+				(Entry->Status == EImportReportStatus::Failed && bShowFailed) ||
+				(Entry->Status == EImportReportStatus::Skipped && bShowSkipped);
+
+			if (bVisible) {
+				VisibleEntries.Add(Entry);
+			}
+		}
+	}
+
+	if (ListView.IsValid()) {
+		ListView->RequestListRefresh();
+	}
+}
+
+TSharedRef<ITableRow> SImportReportPanel::GenerateRow(TSharedPtr<FImportReportEntry> Entry, const TSharedRef<STableViewBase>& OwnerTable) const {
+	return SNew(SImportReportRow, OwnerTable, Entry);
+}
+
+FText SImportReportPanel::GetSummaryText() const {
+	return SummaryText;
+}
+
+FText SImportReportPanel::GetDetailsText() const {
+	return DetailsText;
+}
+
+FText SImportReportPanel::BuildSummaryText() const {
+	if (!Report.IsValid()) {
+		return LOCTEXT("NoReport", "No import report yet, import some files to see their results here.");
+	}
+
+	return FText::FromString(FString::Printf(TEXT("%s: %d files in %.2f seconds, %d imported, %d failed, %d skipped"),
+		*Report->Started.ToString(), Report->Files, Report->Seconds,
+		Report->Count(EImportReportStatus::Imported), Report->Count(EImportReportStatus::Failed), Report->Count(EImportReportStatus::Skipped)
+	));
+}
+
+FText SImportReportPanel::BuildDetailsText() const {
+	if (!Report.IsValid()) {
+		return FText::GetEmpty();
+	}
+
+	FString Details = TEXT("Timings per type:");
+
+	TMap<FString, FImportReportTypeTiming> SortedTypes = Report->Types;
+	SortedTypes.ValueSort([](const FImportReportTypeTiming& A, const FImportReportTypeTiming& B) { return A.Seconds > B.Seconds; });
+
+	for (const TPair<FString, FImportReportTypeTiming>& Pair : SortedTypes) {
+		Details += FString::Printf(TEXT("\n  %s: %d in %.2f seconds (%d failed)"), *Pair.Key, Pair.Value.Count, Pair.Value.Seconds, Pair.Value.Failed);
+
+		if (const double* Delta = Report->Comparison.TypeSecondsDelta.Find(Pair.Key)) {
+			Details += FString::Printf(TEXT(", %+.2f seconds compared to last time"), *Delta);
+		}
+
+		TMap<FString, double> SortedPhases = Pair.Value.Phases;
+		SortedPhases.ValueSort([](const double A, const double B) { return A > B; });
+
+		for (const TPair<FString, double>& Phase : SortedPhases) {
+			Details += FString::Printf(TEXT("\n      %s: %.2f seconds"), *Phase.Key, Phase.Value);
+		}
+	}
+
+	if (Report->UnresolvedReferences.Num() > 0) {
+		Details += FString::Printf(TEXT("\n\nUnresolved references (%d):"), Report->UnresolvedReferences.Num());
+
+		for (const TPair<FString, int32>& Pair : Report->UnresolvedReferences) {
+			Details += FString::Printf(TEXT("\n  %s (%dx)"), *Pair.Key, Pair.Value);
+		}
+	}
+
+	const FImportReportComparison& Comparison = Report->Comparison;
+
+	if (!Comparison.PreviousReport.IsEmpty()) {
+		Details += FString::Printf(TEXT("\n\nCompared to %s:"), *FPaths::GetBaseFilename(Comparison.PreviousReport));
+
+		for (const FString& Package : Comparison.NewFailures) {
+			Details += TEXT("\n  New failure: ") + Package;
+		}
+
+		for (const FString& Package : Comparison.Fixed) {
+			Details += TEXT("\n  Fixed: ") + Package;
+		}
+
+		if (Comparison.NewFailures.Num() == 0 && Comparison.Fixed.Num() == 0) {
+			Details += TEXT("\n  No assets changed status");
+		}
+	}
+
+	return FText::FromString(Details);
+}
+
+#undef LOCTEXT_NAMESPACE
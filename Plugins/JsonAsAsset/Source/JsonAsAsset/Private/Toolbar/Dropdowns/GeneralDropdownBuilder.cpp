@@ -2,6 +2,7 @@
 
 #include "Toolbar/Dropdowns/GeneralDropdownBuilder.h"
 
+#include "Modules/UI/ImportReportPanel.h"
 #include "Utilities/Compatibility.h"
 #include "Utilities/EngineUtilities.h"
 
@@ -34,4 +35,15 @@ void IGeneralDropdownBuilder::Build(FMenuBuilder& MenuBuilder) const {
 		),
 		NAME_None
 	);
+	MenuBuilder.AddMenuEntry(
+		FText::FromString("Open Import Report"),
+		FText::FromString("View the results of the last import"),
+		FSlateIcon(FAppStyle::GetAppStyleSetName(), "MessageLog.TabIcon"),
+		FUIAction(
+			FExecuteAction::CreateLambda([] {
+				SImportReportPanel::Open();
+			})
+		),
+		NAME_None
+	);
 }
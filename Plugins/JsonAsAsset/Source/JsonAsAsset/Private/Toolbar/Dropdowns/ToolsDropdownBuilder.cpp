@@ -9,6 +9,7 @@
 #include "Modules/Tools/AnimationData.h"
 #include "Modules/Tools/ClearImportData.h"
 #include "Modules/Tools/ConvexCollision.h"
+#include "Modules/Tools/PreflightAnalysis.h"
 #include "Modules/Tools/SkeletalMeshData.h"
 
 void IToolsDropdownBuilder::Build(FMenuBuilder& MenuBuilder) const {
@@ -34,6 +35,17 @@ void IToolsDropdownBuilder::Build(FMenuBuilder& MenuBuilder) const {
 					),
 					NAME_None
 				);
+
+				InnerMenuBuilder.AddMenuEntry(
+					FText::FromString("Preflight Analysis"),
+					FText::FromString("Scans a folder of exports without importing anything and reports types, unsupported exports, references and an estimated import time."),
+					FSlateIcon(FAppStyle::GetAppStyleSetName(), "LevelEditor.BspMode"),
+
+					FUIAction(
+						FExecuteAction::CreateStatic(&FToolPreflightAnalysis::Execute)
+					),
+					NAME_None
+				);
 			}
 			InnerMenuBuilder.EndSection();
 
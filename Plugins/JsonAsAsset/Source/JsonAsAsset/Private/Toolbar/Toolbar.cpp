@@ -12,6 +12,7 @@
 
 #include "Interfaces/IPluginManager.h"
 #include "Modules/CloudModule.h"
+#include "Modules/ImportQueue.h"
 #include "Toolbar/Dropdowns/ActionRequiredDropdownBuilder.h"
 #include "Toolbar/Dropdowns/GeneralDropdownBuilder.h"
 #include "Toolbar/Dropdowns/CloudDropdownBuilder.h"
@@ -156,11 +157,11 @@ void FJsonAsAssetToolbar::ImportAction() {
 		return;
 	}
 
-	for (FString& File : OutFileNames) {
-		EmptyMessageLog();
+	/* New import session, classes may have been added since the last one */
+	FTypeResolver::Invalidate();
 
-		IImporter::ImportReference(File);
-	}
+	/* Imported over several frames, the editor stays responsive and the import can be cancelled */
+	FImportQueue::Enqueue(OutFileNames);
 }
 
 /* ReSharper disable once CppMemberFunctionMayBeStatic */
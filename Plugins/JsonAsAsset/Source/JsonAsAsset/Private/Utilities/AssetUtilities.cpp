@@ -22,6 +22,7 @@
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "Utilities/RemoteUtilities.h"
+#include "Utilities/ImportTrace.h"
 
 /* CreateAssetPackage Implementations ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 UPackage* FAssetUtilities::CreateAssetPackage(const FString& FullPath) {
@@ -307,6 +308,8 @@ bool FAssetUtilities::Construct_TypeTexture(const FString& Path, const FString&
 
 	/* Save texture */
 	if (Settings->AssetSettings.bSavePackagesOnImport) {
+		JSONASASSET_TRACE_SCOPE("SavePackage", SavePackages)
+
 		const FString PackageName = Package->GetName();
 		const FString PackageFileName = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
 #if ENGINE_UE5
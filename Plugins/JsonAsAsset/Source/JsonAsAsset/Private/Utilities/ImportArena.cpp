@@ -0,0 +1,75 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/ImportArena.h"
+
+#include "Modules/LogCategory.h"
+#include "Misc/MemStack.h"
+
+namespace {
+	FMemStackBase& GetArena() {
+		static FMemStackBase Arena;
+
+		return Arena;
+	}
+
+	int32 GSessionDepth = 0;
+	TOptional<FMemMark> GSessionMark;
+
+	/* Allocations made while no session was open */
+	TArray<void*> GOrphanedAllocations;
+
+	/* Statistics of the current session */
+	int32 GSessionAllocations = 0;
+	uint64 GSessionBytes = 0;
+	double GSessionStart = 0.0;
+}
+
+FImportArena::FScope::FScope() {
+	check(IsInGameThread());
+
+	if (GSessionDepth++ > 0) return;
+
+	GSessionMark.Emplace(GetArena());
+
+	GSessionAllocations = 0;
+	GSessionBytes = 0;
+	GSessionStart = FPlatformTime::Seconds();
+}
+
+FImportArena::FScope::~FScope() {
+	if (--GSessionDepth > 0) return;
+
+	/* Pops everything allocated since the session started */
+	GSessionMark.Reset();
+
+	for (void* Allocation : GOrphanedAllocations) {
+		FMemory::Free(Allocation);
+	}
+
+	GOrphanedAllocations.Empty();
+
+	if (GSessionAllocations > 0) {
+		UE_LOG(LogJsonAsAsset, Verbose, TEXT("Import session released %d transient allocations (%.1f MB) after %.2f seconds"),
+			GSessionAllocations, GSessionBytes / (1024.0 * 1024.0), FPlatformTime::Seconds() - GSessionStart);
+	}
+}
+
+void* FImportArena::Alloc(const SIZE_T Size, const uint32 Alignment) {
+	check(IsInGameThread());
+
+	GSessionAllocations++;
+	GSessionBytes += Size;
+
+	if (!IsSessionActive()) {
+		void* Allocation = FMemory::Malloc(Size, Alignment);
+		GOrphanedAllocations.Add(Allocation);
+
+		return Allocation;
+	}
+
+	return GetArena().Alloc(Size, Alignment);
+}
+
+bool FImportArena::IsSessionActive() {
+	return GSessionDepth > 0;
+}
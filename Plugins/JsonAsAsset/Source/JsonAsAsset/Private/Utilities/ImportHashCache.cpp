@@ -0,0 +1,175 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/ImportHashCache.h"
+
+#include "Interfaces/IPluginManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Settings/JsonAsAssetSettings.h"
+#include "Utilities/Compatibility.h"
+
+namespace {
+	FDelegateHandle GAssetRemovedHandle;
+	FDelegateHandle GAssetRenamedHandle;
+}
+
+FString FImportHashCache::ComputeHash(const TArray<TSharedPtr<FJsonValue>>& Exports) {
+	FSHA1 Hasher;
+
+	/* Hashed an export at a time, so only the largest export is ever held as text */
+	FString Content;
+
+	for (const TSharedPtr<FJsonValue>& Export : Exports) {
+		Content.Reset();
+
+		if (Export.IsValid()) {
+			const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Content);
+			FJsonSerializer::Serialize(TArray<TSharedPtr<FJsonValue>> { Export }, Writer);
+		}
+
+		Hasher.Update(reinterpret_cast<const uint8*>(*Content), Content.Len() * sizeof(TCHAR));
+	}
+
+	/* The same json imports differently with other settings */
+	const FString Fingerprint = GetSettingsFingerprint();
+	Hasher.Update(reinterpret_cast<const uint8*>(*Fingerprint), Fingerprint.Len() * sizeof(TCHAR));
+
+	FSHAHash Hash;
+	Hasher.Final();
+	Hasher.GetHash(Hash.Hash);
+
+	return Hash.ToString();
+}
+
+bool FImportHashCache::IsUpToDate(const FString& PackageName, const FString& Hash) {
+	const FEntry* Entry = GetEntries().Find(PackageName);
+
+	return Entry != nullptr && Entry->Hash == Hash && Entry->Version == GetPluginVersion();
+}
+
+void FImportHashCache::Record(const FString& PackageName, const FString& Hash) {
+	FEntry Entry; {
+		Entry.Hash = Hash;
+		Entry.Version = GetPluginVersion();
+	}
+
+	GetEntries().Add(PackageName, Entry);
+	AppendLine(PackageName, Entry);
+}
+
+void FImportHashCache::Invalidate(const FString& PackageName) {
+	if (GetEntries().Remove(PackageName) > 0) {
+		AppendLine(PackageName, FEntry());
+	}
+}
+
+TMap<FString, FImportHashCache::FEntry>& FImportHashCache::GetEntries() {
+	static TMap<FString, FEntry> Entries;
+	static bool bLoaded = false;
+
+	if (bLoaded) {
+		return Entries;
+	}
+
+	bLoaded = true;
+
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *GetCachePath())) {
+		return Entries;
+	}
+
+	for (const FString& Line : Lines) {
+		TArray<FString> Columns;
+		Line.ParseIntoArray(Columns, TEXT("\t"), false);
+
+		if (Columns.Num() != 3) continue;
+
+		/* An empty hash is an invalidated entry */
+		if (Columns[1].IsEmpty()) {
+			Entries.Remove(Columns[0]);
+			continue;
+		}
+
+		FEntry Entry; {
+			Entry.Hash = Columns[1];
+			Entry.Version = Columns[2];
+		}
+
+		Entries.Add(Columns[0], Entry);
+	}
+
+	/* Compact the file once it mostly consists of overridden lines */
+	if (Lines.Num() > Entries.Num() * 2) {
+		FString Content;
+
+		for (const TPair<FString, FEntry>& Pair : Entries) {
+			Content += FString::Printf(TEXT("%s\t%s\t%s\n"), *Pair.Key, *Pair.Value.Hash, *Pair.Value.Version);
+		}
+
+		FFileHelper::SaveStringToFile(Content, *GetCachePath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+
+	return Entries;
+}
+
+FString FImportHashCache::GetSettingsFingerprint() {
+	FAssetSettings AssetSettings = GetDefault<UJsonAsAssetSettings>()->AssetSettings;
+
+	/* These only change how imports are scheduled, not the assets they create */
+	const FAssetSettings Defaults;
+	AssetSettings.bSkipUnchangedImports = Defaults.bSkipUnchangedImports;
+	AssetSettings.ImportFrameBudgetMs = Defaults.ImportFrameBudgetMs;
+	AssetSettings.ImportMemoryBudgetMB = Defaults.ImportMemoryBudgetMB;
+
+	FString Fingerprint;
+	FAssetSettings::StaticStruct()->ExportText(Fingerprint, &AssetSettings, nullptr, nullptr, PPF_None, nullptr);
+
+	return Fingerprint;
+}
+
+FString FImportHashCache::GetCachePath() {
+	return FPaths::ProjectSavedDir() / TEXT("JsonAsAsset/ImportHashes.txt");
+}
+
+const FString& FImportHashCache::GetPluginVersion() {
+	static FString Version; {
+		if (Version.IsEmpty()) {
+			const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin("JsonAsAsset");
+			Version = Plugin.IsValid() ? Plugin->GetDescriptor().VersionName : TEXT("Unknown");
+		}
+	}
+
+	return Version;
+}
+
+void FImportHashCache::AppendLine(const FString& PackageName, const FEntry& Entry) {
+	const FString Line = FString::Printf(TEXT("%s\t%s\t%s\n"), *PackageName, *Entry.Hash, *Entry.Version);
+
+	FFileHelper::SaveStringToFile(Line, *GetCachePath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append);
+}
+
+void FImportHashCache::Initialize() {
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	GAssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddLambda([](const FAssetData& AssetData) {
+		Invalidate(AssetData.PackageName.ToString());
+	});
+
+	GAssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddLambda([](const FAssetData& AssetData, const FString& OldObjectPath) {
+		Invalidate(FPackageName::ObjectPathToPackageName(OldObjectPath));
+		Invalidate(AssetData.PackageName.ToString());
+	});
+}
+
+void FImportHashCache::Shutdown() {
+	if (!FModuleManager::Get().IsModuleLoaded("AssetRegistry")) return;
+
+	IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	AssetRegistry.OnAssetRemoved().Remove(GAssetRemovedHandle);
+	AssetRegistry.OnAssetRenamed().Remove(GAssetRenamedHandle);
+}
@@ -0,0 +1,85 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/ImportMemory.h"
+
+#include "Modules/LogCategory.h"
+#include "Settings/JsonAsAssetSettings.h"
+#include "Utilities/EngineUtilities.h"
+
+#include "HAL/PlatformMemory.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectHash.h"
+
+namespace {
+	uint64 GPeakImportMemory = 0;
+
+	/* Saved since the last trim */
+	TArray<TWeakObjectPtr<UPackage>> GSavedPackages;
+}
+
+uint64 FImportMemory::GetUsedMemory() {
+	const uint64 Used = FPlatformMemory::GetStats().UsedPhysical;
+	GPeakImportMemory = FMath::Max(GPeakImportMemory, Used);
+
+	return Used;
+}
+
+bool FImportMemory::IsOverBudget() {
+	const int32 BudgetMB = GetDefault<UJsonAsAssetSettings>()->AssetSettings.ImportMemoryBudgetMB;
+	const uint64 Used = GetUsedMemory();
+
+	return BudgetMB > 0 && Used > static_cast<uint64>(BudgetMB) * 1024 * 1024;
+}
+
+void FImportMemory::TrimBetweenFiles() {
+	if (!IsOverBudget()) return;
+
+	const uint64 Before = GetUsedMemory();
+
+	ClearExportCache();
+
+	/* Standalone assets are kept by the editor's garbage collection, saved ones don't need to be */
+	for (const TWeakObjectPtr<UPackage>& SavedPackage : GSavedPackages) {
+		UPackage* Package = SavedPackage.Get();
+		if (Package == nullptr || Package->IsDirty()) continue;
+
+		ForEachObjectWithPackage(Package, [](UObject* Object) {
+			if (!Object->IsRooted()) {
+				Object->ClearFlags(RF_Standalone);
+			}
+
+			return true;
+		}, false);
+	}
+
+	GSavedPackages.Reset();
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	UE_LOG(LogJsonAsAsset, Log, TEXT("Over the import memory budget, trimmed %.1f MB"), (static_cast<double>(Before) - static_cast<double>(GetUsedMemory())) / (1024.0 * 1024.0));
+}
+
+void FImportMemory::ReleaseSavedPackage(UPackage* Package) {
+	/* Rooted when the asset was created, so it survives garbage collection until it's on disk */
+	ForEachObjectWithPackage(Package, [](UObject* Object) {
+		if (Object->IsAsset() && Object->IsRooted()) {
+			Object->RemoveFromRoot();
+		}
+
+		return true;
+	}, false);
+
+	GSavedPackages.AddUnique(Package);
+}
+
+uint64 FImportMemory::GetPeakMemory() {
+	GetUsedMemory();
+
+	return GPeakImportMemory;
+}
+
+void FImportMemory::ResetPeakMemory() {
+	GPeakImportMemory = 0;
+	GetUsedMemory();
+}
@@ -0,0 +1,409 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/ImportPreflight.h"
+
+#include "Importers/Constructor/Importer.h"
+#include "Settings/JsonAsAssetSettings.h"
+#include "Utilities/Serializers/ReferenceResolver.h"
+#include "Utilities/TypeResolver.h"
+
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace {
+	struct FPreflightExport {
+		FString Type;
+		FString Name;
+		FString Outer;
+	};
+
+	struct FPreflightFile {
+		FString PackageKey;
+
+		TArray<FPreflightExport> Exports;
+		TSet<FString> ObjectPaths;
+
+		bool bParsed = false;
+	};
+
+	/* Rough seconds per export of the heavier importers, anything else uses the default */
+	const TMap<FString, double> GPreflightExportCost = {
+		{ TEXT("Material"), 0.5 },
+		{ TEXT("MaterialFunction"), 0.25 },
+		{ TEXT("AnimBlueprintGeneratedClass"), 1.0 },
+		{ TEXT("AnimSequence"), 0.3 },
+		{ TEXT("SoundCue"), 0.1 },
+		{ TEXT("DataTable"), 0.1 },
+		{ TEXT("Texture2D"), 0.25 },
+		{ TEXT("PhysicsAsset"), 0.2 },
+		{ TEXT("Skeleton"), 0.1 }
+	};
+
+	constexpr double GPreflightDefaultExportCost = 0.02;
+	constexpr double GPreflightRemoteDownloadCost = 0.5;
+}
+
+/* Streams through a file, only keeping what the report needs */
+static bool ScanFile(const FString& Path, FPreflightFile& OutFile) {
+	FString Content;
+	if (!FFileHelper::LoadFileToString(Content, *Path)) return false;
+
+	const TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create(Content);
+
+	/* The file is an array of exports, exports are objects at depth 2 */
+	int32 Depth = 0;
+	FPreflightExport Export;
+	EJsonNotation Notation;
+
+	while (Reader->ReadNext(Notation)) {
+		switch (Notation) {
+			case EJsonNotation::ObjectStart:
+			case EJsonNotation::ArrayStart:
+				Depth++;
+
+				if (Depth == 2 && Notation == EJsonNotation::ObjectStart) {
+					Export = FPreflightExport();
+				}
+				break;
+
+			case EJsonNotation::ObjectEnd:
+			case EJsonNotation::ArrayEnd:
+				if (Depth == 2 && Notation == EJsonNotation::ObjectEnd) {
+					OutFile.Exports.Add(MoveTemp(Export));
+				}
+
+				Depth--;
+				break;
+
+			case EJsonNotation::String: {
+				const FString& Identifier = Reader->GetIdentifier();
+
+				if (Depth == 2) {
+					if (Identifier == TEXT("Type")) Export.Type = Reader->GetValueAsString();
+					else if (Identifier == TEXT("Name")) Export.Name = Reader->GetValueAsString();
+					else if (Identifier == TEXT("Outer")) Export.Outer = Reader->GetValueAsString();
+				} else if (Identifier == TEXT("ObjectPath") || Identifier == TEXT("AssetPathName")) {
+					OutFile.ObjectPaths.Add(Reader->GetValueAsString());
+				}
+				break;
+			}
+
+			case EJsonNotation::Error:
+				return false;
+
+			default:
+				break;
+		}
+	}
+
+	return Reader->GetErrorMessage().IsEmpty();
+}
+
+/* Longest reference chain between the files, using Kahn's algorithm level by level */
+static void ComputeDependencyDepth(const TArray<FPreflightFile>& Files, FImportPreflightReport& Report) {
+	TMap<FString, int32> FileByPackage; {
+		FileByPackage.Reserve(Files.Num());
+
+		for (int32 Index = 0; Index < Files.Num(); Index++) {
+			FileByPackage.Add(Files[Index].PackageKey, Index);
+		}
+	}
+
+	TArray<TArray<int32>> Dependents;
+	TArray<int32> InDegree, Level;
+	Dependents.SetNum(Files.Num());
+	InDegree.SetNumZeroed(Files.Num());
+	Level.SetNumZeroed(Files.Num());
+
+	for (int32 Index = 0; Index < Files.Num(); Index++) {
+		TSet<int32> Dependencies;
+
+		for (const FString& ObjectPath : Files[Index].ObjectPaths) {
+			const int32* Dependency = FileByPackage.Find(FImportPreflight::ToPackageKey(ObjectPath));
+
+			if (Dependency != nullptr && *Dependency != Index && !Dependencies.Contains(*Dependency)) {
+				Dependencies.Add(*Dependency);
+				Dependents[*Dependency].Add(Index);
+				InDegree[Index]++;
+			}
+		}
+	}
+
+	TArray<int32> Order;
+	Order.Reserve(Files.Num());
+
+	for (int32 Index = 0; Index < Files.Num(); Index++) {
+		if (InDegree[Index] == 0) {
+			Order.Add(Index);
+			Level[Index] = 1;
+		}
+	}
+
+	for (int32 Head = 0; Head < Order.Num(); Head++) {
+		const int32 Current = Order[Head];
+		Report.DependencyDepth = FMath::Max(Report.DependencyDepth, Level[Current]);
+
+		for (const int32 Dependent : Dependents[Current]) {
+			Level[Dependent] = FMath::Max(Level[Dependent], Level[Current] + 1);
+
+			if (--InDegree[Dependent] == 0) {
+				Order.Add(Dependent);
+			}
+		}
+	}
+
+	Report.FilesInCycles = Files.Num() - Order.Num();
+}
+
+FImportPreflightReport FImportPreflight::Analyze(const TArray<FString>& Files) {
+	const double StartTime = FPlatformTime::Seconds();
+
+	FImportPreflightReport Report;
+	Report.Files = Files.Num();
+
+	/* Scan ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	TArray<FPreflightFile> ScannedFiles;
+	ScannedFiles.SetNum(Files.Num());
+
+	ParallelFor(Files.Num(), [&Files, &ScannedFiles](const int32 Index) {
+		FPreflightFile& File = ScannedFiles[Index];
+
+		File.PackageKey = ToPackageKey(Files[Index]);
+		File.bParsed = ScanFile(Files[Index], File);
+	});
+
+	/* Types ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	/* Class lookups have to happen on the game thread, each type is only checked once */
+	TMap<FString, bool> ImportableTypes;
+	TMap<FString, int32> UniqueReferences;
+
+	for (const FPreflightFile& File : ScannedFiles) {
+		if (!File.bParsed) {
+			Report.UnreadableFiles++;
+			continue;
+		}
+
+		bool bHasImportableExport = false;
+
+		for (const FPreflightExport& Export : File.Exports) {
+			Report.Exports++;
+			Report.TypeCounts.FindOrAdd(Export.Type)++;
+
+			const bool* bCachedImportable = ImportableTypes.Find(Export.Type);
+
+			if (bCachedImportable == nullptr) {
+				const UClass* Class = FTypeResolver::FindClass(Export.Type);
+
+				bCachedImportable = &ImportableTypes.Add(Export.Type, Class != nullptr && IImporter::CanImport(Export.Type, false, Class));
+
+				if (Class == nullptr) {
+					Report.MissingClasses.Add(Export.Type, 0);
+				}
+			}
+
+			if (*bCachedImportable) {
+				Report.ImportableExports++;
+				const double* Cost = GPreflightExportCost.Find(Export.Type);
+				Report.EstimatedSeconds += Cost != nullptr ? *Cost : GPreflightDefaultExportCost;
+
+				bHasImportableExport = true;
+
+				continue;
+			}
+
+			if (int32* Missing = Report.MissingClasses.Find(Export.Type)) {
+				(*Missing)++;
+			}
+			/* Subobjects are created with their asset, only top level exports are rejected */
+			else if (Export.Outer.IsEmpty()) {
+				Report.UnsupportedTypes.FindOrAdd(Export.Type)++;
+			}
+		}
+
+		if (!bHasImportableExport) {
+			Report.SkippedFiles++;
+		}
+
+		for (const FString& ObjectPath : File.ObjectPaths) {
+			UniqueReferences.FindOrAdd(ToPackageKey(ObjectPath), INDEX_NONE);
+		}
+	}
+
+	/* References ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	TSet<FString> FilePackages; {
+		FilePackages.Reserve(ScannedFiles.Num());
+
+		for (const FPreflightFile& File : ScannedFiles) {
+			FilePackages.Add(File.PackageKey);
+		}
+	}
+
+	/* One original ObjectPath per package, to ask the project whether it already exists */
+	TArray<FString> ProjectCandidates;
+
+	for (const FPreflightFile& File : ScannedFiles) {
+		for (const FString& ObjectPath : File.ObjectPaths) {
+			int32& State = UniqueReferences.FindChecked(ToPackageKey(ObjectPath));
+			if (State != INDEX_NONE) continue;
+
+			if (FilePackages.Contains(ToPackageKey(ObjectPath))) {
+				State = 0;
+				Report.ReferencesInFiles++;
+			} else {
+				State = 1;
+				ProjectCandidates.Add(FReferenceResolver::ToLongPackageName(ObjectPath));
+			}
+		}
+	}
+
+	Report.References = UniqueReferences.Num();
+
+	TArray<bool> ExistsInProject;
+	ExistsInProject.SetNumZeroed(ProjectCandidates.Num());
+
+	ParallelFor(ProjectCandidates.Num(), [&ProjectCandidates, &ExistsInProject](const int32 Index) {
+		const FString& PackageName = ProjectCandidates[Index];
+
+		ExistsInProject[Index] = PackageName.StartsWith(TEXT("/Script/"))
+			|| (FPackageName::IsValidLongPackageName(PackageName) && FPackageName::DoesPackageExist(PackageName));
+	});
+
+	for (const bool bExists : ExistsInProject) {
+		if (bExists) Report.ReferencesInProject++;
+		else Report.MissingReferences++;
+	}
+
+	/* Missing references are downloaded by the importer when Cloud is enabled */
+	if (GetDefault<UJsonAsAssetSettings>()->bEnableCloudServer) {
+		Report.RemoteDownloads = Report.MissingReferences;
+		Report.EstimatedSeconds += Report.RemoteDownloads * GPreflightRemoteDownloadCost;
+	}
+
+	ComputeDependencyDepth(ScannedFiles, Report);
+
+	Report.ScanSeconds = FPlatformTime::Seconds() - StartTime;
+
+	return Report;
+}
+
+FImportPreflightReport FImportPreflight::AnalyzeDirectory(const FString& Directory) {
+	TArray<FString> Files;
+	IFileManager::Get().FindFilesRecursive(Files, *Directory, TEXT("*.json"), true, false);
+
+	return Analyze(Files);
+}
+
+FString FImportPreflight::SaveReport(const FImportPreflightReport& Report) {
+	const FString Path = FPaths::ProjectSavedDir() / TEXT("JsonAsAsset/PreflightReport.json");
+
+	FString Content;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
+	FJsonSerializer::Serialize(Report.ToJson(), Writer);
+
+	FFileHelper::SaveStringToFile(Content, *Path);
+
+	return Path;
+}
+
+FString FImportPreflight::ToPackageKey(const FString& Path) {
+	FString Key = Path.Replace(TEXT("\\"), TEXT("/"));
+
+	/* Remove the object name or the file extension */
+	int32 SlashIndex = INDEX_NONE, DotIndex = INDEX_NONE;
+	Key.FindLastChar('/', SlashIndex);
+	Key.FindLastChar('.', DotIndex);
+
+	if (DotIndex != INDEX_NONE && DotIndex > SlashIndex) {
+		Key.LeftInline(DotIndex);
+	}
+
+	/* GameName/Content/Folder/Asset -> Game/Folder/Asset */
+	/* GameName/Plugins/PluginName/Content/Folder/Asset -> PluginName/Folder/Asset */
+	FString MountPath, ContentPath;
+	if (Key.Split(TEXT("/Content/"), &MountPath, &ContentPath, ESearchCase::IgnoreCase, ESearchDir::FromEnd)) {
+		FString MountName = TEXT("Game");
+
+		if (MountPath.Contains(TEXT("Plugins/")) || MountPath.Equals(TEXT("Engine"), ESearchCase::IgnoreCase) || MountPath.EndsWith(TEXT("/Engine"), ESearchCase::IgnoreCase)) {
+			/* The last folder is the mount, or the whole path when it's only one folder (Engine) */
+			if (!MountPath.Split(TEXT("/"), nullptr, &MountName, ESearchCase::IgnoreCase, ESearchDir::FromEnd)) {
+				MountName = MountPath;
+			}
+		}
+
+		Key = MountName / ContentPath;
+	}
+
+	Key.RemoveFromStart(TEXT("/"));
+
+	return Key.ToLower();
+}
+
+/* Sorted by count, largest first */
+static TSharedRef<FJsonObject> CountsToJson(TMap<FString, int32> Counts) {
+	Counts.ValueSort([](const int32 A, const int32 B) { return A > B; });
+
+	TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+
+	for (const TPair<FString, int32>& Pair : Counts) {
+		Object->SetNumberField(Pair.Key, Pair.Value);
+	}
+
+	return Object;
+}
+
+TSharedRef<FJsonObject> FImportPreflightReport::ToJson() const {
+	TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+
+	Object->SetNumberField(TEXT("Files"), Files);
+	Object->SetNumberField(TEXT("UnreadableFiles"), UnreadableFiles);
+	Object->SetNumberField(TEXT("SkippedFiles"), SkippedFiles);
+	Object->SetNumberField(TEXT("Exports"), Exports);
+	Object->SetNumberField(TEXT("ImportableExports"), ImportableExports);
+	Object->SetObjectField(TEXT("Types"), CountsToJson(TypeCounts));
+	Object->SetObjectField(TEXT("UnsupportedTypes"), CountsToJson(UnsupportedTypes));
+	Object->SetObjectField(TEXT("MissingClasses"), CountsToJson(MissingClasses));
+	Object->SetNumberField(TEXT("References"), References);
+	Object->SetNumberField(TEXT("ReferencesInFiles"), ReferencesInFiles);
+	Object->SetNumberField(TEXT("ReferencesInProject"), ReferencesInProject);
+	Object->SetNumberField(TEXT("MissingReferences"), MissingReferences);
+	Object->SetNumberField(TEXT("RemoteDownloads"), RemoteDownloads);
+	Object->SetNumberField(TEXT("DependencyDepth"), DependencyDepth);
+	Object->SetNumberField(TEXT("FilesInCycles"), FilesInCycles);
+	Object->SetNumberField(TEXT("EstimatedSeconds"), EstimatedSeconds);
+	Object->SetNumberField(TEXT("ScanSeconds"), ScanSeconds);
+
+	return Object;
+}
+
+FString FImportPreflightReport::ToString() const {
+	FString Result = FString::Printf(
+		TEXT("%d files (%d unreadable, %d without importable exports), %d exports (%d importable)\n")
+		TEXT("%d referenced packages: %d in these files, %d in the project, %d missing (%d remote downloads)\n")
+		TEXT("Dependency depth %d (%d files in reference cycles), estimated import time %.0f seconds, analyzed in %.2f seconds"),
+		Files, UnreadableFiles, SkippedFiles, Exports, ImportableExports,
+		References, ReferencesInFiles, ReferencesInProject, MissingReferences, RemoteDownloads,
+		DependencyDepth, FilesInCycles, EstimatedSeconds, ScanSeconds
+	);
+
+	auto AppendCounts = [&Result](const TCHAR* Title, TMap<FString, int32> Counts) {
+		if (Counts.Num() == 0) return;
+
+		Counts.ValueSort([](const int32 A, const int32 B) { return A > B; });
+		Result += FString::Printf(TEXT("\n%s:"), Title);
+
+		for (const TPair<FString, int32>& Pair : Counts) {
+			Result += FString::Printf(TEXT("\n  %s: %d"), *Pair.Key, Pair.Value);
+		}
+	};
+
+	AppendCounts(TEXT("Types"), TypeCounts);
+	AppendCounts(TEXT("Unsupported types"), UnsupportedTypes);
+	AppendCounts(TEXT("Missing classes"), MissingClasses);
+
+	return Result;
+}
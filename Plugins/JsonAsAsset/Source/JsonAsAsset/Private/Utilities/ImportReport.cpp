@@ -0,0 +1,445 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/ImportReport.h"
+
+#include "Modules/LogCategory.h"
+#include "Utilities/ImportTrace.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+/* How many reports are kept on disk, older ones are deleted */
+static constexpr int32 GImportReportHistory = 20;
+
+namespace {
+	int32 GSessionDepth = 0;
+	double GSessionStartTime = 0.0;
+	FImportTrace::FSnapshot GSessionTraceSnapshot;
+
+	TSharedPtr<FImportReportData> GCurrentReport;
+	TSharedPtr<const FImportReportData> GLastReport;
+
+	FSimpleMulticastDelegate GOnReportUpdated;
+}
+
+/* Reports are named after the time they were started, so sorting by name sorts by time */
+static TArray<FString> FindReportFiles() {
+	TArray<FString> Files;
+	IFileManager::Get().FindFiles(Files, *(FImportReport::GetReportDirectory() / TEXT("ImportReport_*.json")), true, false);
+
+	Files.Sort();
+
+	for (FString& File : Files) {
+		File = FImportReport::GetReportDirectory() / File;
+	}
+
+	return Files;
+}
+
+static EImportReportStatus StatusFromString(const FString& Status) {
+	if (Status == TEXT("Failed")) return EImportReportStatus::Failed;
+	if (Status == TEXT("Skipped")) return EImportReportStatus::Skipped;
+
+	return EImportReportStatus::Imported;
+}
+
+void FImportReport::BeginSession() {
+	if (GSessionDepth++ > 0) return;
+
+	GCurrentReport = MakeShared<FImportReportData>();
+	GCurrentReport->Started = FDateTime::Now();
+	GSessionStartTime = FPlatformTime::Seconds();
+	GSessionTraceSnapshot = FImportTrace::TakeSnapshot();
+}
+
+FString FImportReport::EndSession() {
+	if (GSessionDepth == 0 || --GSessionDepth > 0) return FString();
+
+	const TSharedPtr<FImportReportData> Report = MoveTemp(GCurrentReport);
+	Report->Seconds = FPlatformTime::Seconds() - GSessionStartTime;
+	Report->Phases = FImportTrace::GetSecondsSince(GSessionTraceSnapshot);
+
+	TArray<FString> PreviousFiles = FindReportFiles();
+
+	/* Compare with the newest report on disk, which may be from an earlier editor session */
+	FImportReportData Previous;
+	if (PreviousFiles.Num() > 0 && LoadReport(PreviousFiles.Last(), Previous)) {
+		Report->Comparison = Compare(Previous, *Report);
+		Report->Comparison.PreviousReport = PreviousFiles.Last();
+	}
+
+	const FString Path = GetReportDirectory() / FString::Printf(TEXT("ImportReport_%s.json"), *Report->Started.ToString());
+
+	FString Content;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
+	FJsonSerializer::Serialize(Report->ToJson(), Writer);
+
+	FFileHelper::SaveStringToFile(Content, *Path);
+
+	/* Trim the history, the newest report was just written */
+	for (int32 Index = 0; Index < PreviousFiles.Num() - (GImportReportHistory - 1); Index++) {
+		IFileManager::Get().Delete(*PreviousFiles[Index]);
+	}
+
+	UE_LOG(LogJsonAsAsset, Log, TEXT("Import report (%s)\n%s"), *Path, *Report->ToString());
+
+	GLastReport = Report;
+	GOnReportUpdated.Broadcast();
+
+	return Path;
+}
+
+bool FImportReport::IsSessionActive() {
+	return GSessionDepth > 0;
+}
+
+void FImportReport::RecordFile() {
+	if (!GCurrentReport.IsValid()) return;
+
+	GCurrentReport->Files++;
+}
+
+void FImportReport::RecordAsset(const FImportReportEntry& Entry) {
+	if (!GCurrentReport.IsValid()) return;
+
+	GCurrentReport->Entries.Add(MakeShared<FImportReportEntry>(Entry));
+
+	/* Files that couldn't be read have no type */
+	if (Entry.Type.IsEmpty()) return;
+
+	FImportReportTypeTiming& Timing = GCurrentReport->Types.FindOrAdd(Entry.Type); {
+		Timing.Count++;
+		Timing.Seconds += Entry.Seconds;
+
+		for (const TPair<FString, double>& Phase : Entry.Phases) {
+			Timing.Phases.FindOrAdd(Phase.Key) += Phase.Value;
+		}
+
+		if (Entry.Status == EImportReportStatus::Failed) {
+			Timing.Failed++;
+		}
+	}
+}
+
+void FImportReport::RecordUnresolvedReference(const FString& Reference) {
+	if (!GCurrentReport.IsValid()) return;
+
+	GCurrentReport->UnresolvedReferences.FindOrAdd(Reference)++;
+}
+
+TSharedPtr<const FImportReportData> FImportReport::GetLastReport() {
+	/* Show the newest report on disk until a session finishes */
+	if (!GLastReport.IsValid()) {
+		const TArray<FString> Files = FindReportFiles();
+		const TSharedPtr<FImportReportData> Report = MakeShared<FImportReportData>();
+
+		if (Files.Num() > 0 && LoadReport(Files.Last(), *Report)) {
+			GLastReport = Report;
+		}
+	}
+
+	return GLastReport;
+}
+
+FSimpleMulticastDelegate& FImportReport::OnReportUpdated() {
+	return GOnReportUpdated;
+}
+
+FString FImportReport::GetReportDirectory() {
+	return FPaths::ProjectSavedDir() / TEXT("JsonAsAsset/ImportReports");
+}
+
+bool FImportReport::LoadReport(const FString& Path, FImportReportData& OutReport) {
+	FString Content;
+	if (!FFileHelper::LoadFileToString(Content, *Path)) return false;
+
+	TSharedPtr<FJsonObject> Object;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Content);
+
+	if (!FJsonSerializer::Deserialize(Reader, Object) || !Object.IsValid()) {
+		UE_LOG(LogJsonAsAsset, Warning, TEXT("Unable to read import report %s"), *Path);
+
+		return false;
+	}
+
+	return FImportReportData::FromJson(Object, OutReport);
+}
+
+FImportReportComparison FImportReport::Compare(const FImportReportData& Previous, const FImportReportData& Current) {
+	FImportReportComparison Comparison;
+
+	TMap<FString, EImportReportStatus> PreviousStatus;
+	PreviousStatus.Reserve(Previous.Entries.Num());
+
+	for (const TSharedPtr<FImportReportEntry>& Entry : Previous.Entries) {
+		if (Entry->Package.IsEmpty()) continue;
+
+		PreviousStatus.Add(Entry->Package, Entry->Status);
+	}
+
+	for (const TSharedPtr<FImportReportEntry>& Entry : Current.Entries) {
+		if (Entry->Package.IsEmpty()) continue;
+
+		const EImportReportStatus* Status = PreviousStatus.Find(Entry->Package);
+		if (Status == nullptr) continue;
+
+		if (Entry->Status == EImportReportStatus::Failed && *Status != EImportReportStatus::Failed) {
+			Comparison.NewFailures.Add(Entry->Package);
+		}
+
+		if (Entry->Status == EImportReportStatus::Imported && *Status == EImportReportStatus::Failed) {
+			Comparison.Fixed.Add(Entry->Package);
+		}
+	}
+
+	/* Only types imported both times are comparable */
+	for (const TPair<FString, FImportReportTypeTiming>& Pair : Current.Types) {
+		if (const FImportReportTypeTiming* Timing = Previous.Types.Find(Pair.Key)) {
+			Comparison.TypeSecondsDelta.Add(Pair.Key, Pair.Value.Seconds - Timing->Seconds);
+		}
+	}
+
+	return Comparison;
+}
+
+const TCHAR* FImportReport::StatusToString(const EImportReportStatus Status) {
+	switch (Status) {
+		case EImportReportStatus::Failed: return TEXT("Failed");
+		case EImportReportStatus::Skipped: return TEXT("Skipped");
+		default: return TEXT("Imported");
+	}
+}
+
+int32 FImportReportData::Count(const EImportReportStatus Status) const {
+	int32 Result = 0;
+
+	for (const TSharedPtr<FImportReportEntry>& Entry : Entries) {
+		if (Entry->Status == Status) Result++;
+	}
+
+	return Result;
+}
+
+static TSharedRef<FJsonObject> PhasesToJson(const TMap<FString, double>& Phases) {
+	TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+
+	for (const TPair<FString, double>& Pair : Phases) {
+		Object->SetNumberField(Pair.Key, Pair.Value);
+	}
+
+	return Object;
+}
+
+static void PhasesFromJson(const TSharedPtr<FJsonObject>& Object, const TCHAR* Field, TMap<FString, double>& OutPhases) {
+	const TSharedPtr<FJsonObject>* Phases;
+	if (!Object->TryGetObjectField(Field, Phases)) return;
+
+	for (const auto& Pair : (*Phases)->Values) {
+		OutPhases.Add(Pair.Key, Pair.Value->AsNumber());
+	}
+}
+
+static TArray<TSharedPtr<FJsonValue>> StringsToJson(const TArray<FString>& Strings) {
+	TArray<TSharedPtr<FJsonValue>> Values;
+
+	for (const FString& String : Strings) {
+		Values.Add(MakeShared<FJsonValueString>(String));
+	}
+
+	return Values;
+}
+
+TSharedRef<FJsonObject> FImportReportData::ToJson() const {
+	TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+
+	Object->SetStringField(TEXT("Started"), Started.ToIso8601());
+	Object->SetNumberField(TEXT("Seconds"), Seconds);
+	Object->SetNumberField(TEXT("Files"), Files);
+	Object->SetNumberField(TEXT("Imported"), Count(EImportReportStatus::Imported));
+	Object->SetNumberField(TEXT("Failed"), Count(EImportReportStatus::Failed));
+	Object->SetNumberField(TEXT("Skipped"), Count(EImportReportStatus::Skipped));
+	Object->SetObjectField(TEXT("Phases"), PhasesToJson(Phases));
+
+	/* Slowest types first */
+	TMap<FString, FImportReportTypeTiming> SortedTypes = Types;
+	SortedTypes.ValueSort([](const FImportReportTypeTiming& A, const FImportReportTypeTiming& B) { return A.Seconds > B.Seconds; });
+
+	const TSharedRef<FJsonObject> TypesObject = MakeShared<FJsonObject>();
+
+	for (const TPair<FString, FImportReportTypeTiming>& Pair : SortedTypes) {
+		const TSharedRef<FJsonObject> Timing = MakeShared<FJsonObject>(); {
+			Timing->SetNumberField(TEXT("Count"), Pair.Value.Count);
+			Timing->SetNumberField(TEXT("Failed"), Pair.Value.Failed);
+			Timing->SetNumberField(TEXT("Seconds"), Pair.Value.Seconds);
+			Timing->SetObjectField(TEXT("Phases"), PhasesToJson(Pair.Value.Phases));
+		}
+
+		TypesObject->SetObjectField(Pair.Key, Timing);
+	}
+
+	Object->SetObjectField(TEXT("Types"), TypesObject);
+
+	TArray<TSharedPtr<FJsonValue>> Assets;
+
+	for (const TSharedPtr<FImportReportEntry>& Entry : Entries) {
+		const TSharedRef<FJsonObject> Asset = MakeShared<FJsonObject>(); {
+			Asset->SetStringField(TEXT("Name"), Entry->Name);
+			Asset->SetStringField(TEXT("Type"), Entry->Type);
+			Asset->SetStringField(TEXT("Package"), Entry->Package);
+			Asset->SetStringField(TEXT("File"), Entry->File);
+			Asset->SetStringField(TEXT("Status"), FImportReport::StatusToString(Entry->Status));
+			Asset->SetNumberField(TEXT("Seconds"), Entry->Seconds);
+			Asset->SetObjectField(TEXT("Phases"), PhasesToJson(Entry->Phases));
+
+			if (!Entry->Reason.IsEmpty()) {
+				Asset->SetStringField(TEXT("Reason"), Entry->Reason);
+			}
+		}
+
+		Assets.Add(MakeShared<FJsonValueObject>(Asset));
+	}
+
+	Object->SetArrayField(TEXT("Assets"), Assets);
+
+	const TSharedRef<FJsonObject> References = MakeShared<FJsonObject>();
+
+	for (const TPair<FString, int32>& Pair : UnresolvedReferences) {
+		References->SetNumberField(Pair.Key, Pair.Value);
+	}
+
+	Object->SetObjectField(TEXT("UnresolvedReferences"), References);
+
+	if (!Comparison.PreviousReport.IsEmpty()) {
+		const TSharedRef<FJsonObject> ComparisonObject = MakeShared<FJsonObject>();
+
+		ComparisonObject->SetStringField(TEXT("PreviousReport"), Comparison.PreviousReport);
+		ComparisonObject->SetArrayField(TEXT("NewFailures"), StringsToJson(Comparison.NewFailures));
+		ComparisonObject->SetArrayField(TEXT("Fixed"), StringsToJson(Comparison.Fixed));
+
+		const TSharedRef<FJsonObject> Deltas = MakeShared<FJsonObject>();
+
+		for (const TPair<FString, double>& Pair : Comparison.TypeSecondsDelta) {
+			Deltas->SetNumberField(Pair.Key, Pair.Value);
+		}
+
+		ComparisonObject->SetObjectField(TEXT("TypeSecondsDelta"), Deltas);
+		Object->SetObjectField(TEXT("Comparison"), ComparisonObject);
+	}
+
+	return Object;
+}
+
+bool FImportReportData::FromJson(const TSharedPtr<FJsonObject>& Object, FImportReportData& OutReport) {
+	if (!Object.IsValid() || !Object->HasField(TEXT("Assets"))) return false;
+
+	FDateTime::ParseIso8601(*Object->GetStringField(TEXT("Started")), OutReport.Started);
+	OutReport.Seconds = Object->GetNumberField(TEXT("Seconds"));
+	OutReport.Files = Object->GetIntegerField(TEXT("Files"));
+	PhasesFromJson(Object, TEXT("Phases"), OutReport.Phases);
+
+	for (const TSharedPtr<FJsonValue>& Value : Object->GetArrayField(TEXT("Assets"))) {
+		const TSharedPtr<FJsonObject> Asset = Value->AsObject();
+		if (!Asset.IsValid()) continue;
+
+		const TSharedPtr<FImportReportEntry> Entry = MakeShared<FImportReportEntry>(); {
+			Entry->Name = Asset->GetStringField(TEXT("Name"));
+			Entry->Type = Asset->GetStringField(TEXT("Type"));
+			Entry->Package = Asset->GetStringField(TEXT("Package"));
+			Entry->File = Asset->GetStringField(TEXT("File"));
+			Entry->Status = StatusFromString(Asset->GetStringField(TEXT("Status")));
+			Entry->Seconds = Asset->GetNumberField(TEXT("Seconds"));
+
+			Asset->TryGetStringField(TEXT("Reason"), Entry->Reason);
+			PhasesFromJson(Asset, TEXT("Phases"), Entry->Phases);
+		}
+
+		OutReport.Entries.Add(Entry);
+	}
+
+	const TSharedPtr<FJsonObject>* TypesObject;
+	if (Object->TryGetObjectField(TEXT("Types"), TypesObject)) {
+		for (const auto& Pair : (*TypesObject)->Values) {
+			const TSharedPtr<FJsonObject> Timing = Pair.Value->AsObject();
+			if (!Timing.IsValid()) continue;
+
+			FImportReportTypeTiming& Type = OutReport.Types.Add(Pair.Key); {
+				Type.Count = Timing->GetIntegerField(TEXT("Count"));
+				Type.Failed = Timing->GetIntegerField(TEXT("Failed"));
+				Type.Seconds = Timing->GetNumberField(TEXT("Seconds"));
+			}
+
+			PhasesFromJson(Timing, TEXT("Phases"), Type.Phases);
+		}
+	}
+
+	const TSharedPtr<FJsonObject>* References;
+	if (Object->TryGetObjectField(TEXT("UnresolvedReferences"), References)) {
+		for (const auto& Pair : (*References)->Values) {
+			OutReport.UnresolvedReferences.Add(Pair.Key, static_cast<int32>(Pair.Value->AsNumber()));
+		}
+	}
+
+	const TSharedPtr<FJsonObject>* ComparisonObject;
+	if (Object->TryGetObjectField(TEXT("Comparison"), ComparisonObject)) {
+		FImportReportComparison& Comparison = OutReport.Comparison;
+
+		Comparison.PreviousReport = (*ComparisonObject)->GetStringField(TEXT("PreviousReport"));
+		(*ComparisonObject)->TryGetStringArrayField(TEXT("NewFailures"), Comparison.NewFailures);
+		(*ComparisonObject)->TryGetStringArrayField(TEXT("Fixed"), Comparison.Fixed);
+
+		const TSharedPtr<FJsonObject>* Deltas;
+		if ((*ComparisonObject)->TryGetObjectField(TEXT("TypeSecondsDelta"), Deltas)) {
+			for (const auto& Pair : (*Deltas)->Values) {
+				Comparison.TypeSecondsDelta.Add(Pair.Key, Pair.Value->AsNumber());
+			}
+		}
+	}
+
+	return true;
+}
+
+FString FImportReportData::ToString() const {
+	FString Result = FString::Printf(
+		TEXT("%d files in %.2f seconds: %d imported, %d failed, %d skipped, %d unresolved references"),
+		Files, Seconds, Count(EImportReportStatus::Imported), Count(EImportReportStatus::Failed), Count(EImportReportStatus::Skipped), UnresolvedReferences.Num()
+	);
+
+	TMap<FString, FImportReportTypeTiming> SortedTypes = Types;
+	SortedTypes.ValueSort([](const FImportReportTypeTiming& A, const FImportReportTypeTiming& B) { return A.Seconds > B.Seconds; });
+
+	/* Table of seconds per type and phase, slowest types first */
+	if (SortedTypes.Num() > 0) {
+		constexpr int32 PhaseCount = static_cast<int32>(EImportTracePhase::Count);
+
+		Result += FString::Printf(TEXT("\n%-32s %7s %6s %9s"), TEXT("Type"), TEXT("Count"), TEXT("Failed"), TEXT("Seconds"));
+
+		for (int32 Phase = 0; Phase < PhaseCount; Phase++) {
+			Result += FString::Printf(TEXT(" %21s"), FImportTrace::PhaseToString(static_cast<EImportTracePhase>(Phase)));
+		}
+
+		auto AppendRow = [&Result](const FString& Name, const int32 RowCount, const int32 RowFailed, const double RowSeconds, const TMap<FString, double>& RowPhases) {
+			Result += FString::Printf(TEXT("\n%-32s %7d %6d %9.2f"), *Name, RowCount, RowFailed, RowSeconds);
+
+			for (int32 Phase = 0; Phase < PhaseCount; Phase++) {
+				const double* PhaseSeconds = RowPhases.Find(FImportTrace::PhaseToString(static_cast<EImportTracePhase>(Phase)));
+				Result += FString::Printf(TEXT(" %21.2f"), PhaseSeconds != nullptr ? *PhaseSeconds : 0.0);
+			}
+		};
+
+		for (const TPair<FString, FImportReportTypeTiming>& Pair : SortedTypes) {
+			AppendRow(Pair.Key, Pair.Value.Count, Pair.Value.Failed, Pair.Value.Seconds, Pair.Value.Phases);
+		}
+
+		AppendRow(TEXT("Session"), Entries.Num(), Count(EImportReportStatus::Failed), Seconds, Phases);
+	}
+
+	if (!Comparison.PreviousReport.IsEmpty()) {
+		Result += FString::Printf(TEXT("\nCompared to the previous report: %d new failures, %d fixed"), Comparison.NewFailures.Num(), Comparison.Fixed.Num());
+	}
+
+	return Result;
+}
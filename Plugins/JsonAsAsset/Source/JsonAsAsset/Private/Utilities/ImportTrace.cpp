@@ -0,0 +1,107 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/ImportTrace.h"
+
+#include "ProfilingDebugging/CountersTrace.h"
+
+#include <atomic>
+
+UE_TRACE_CHANNEL_DEFINE(JsonAsAssetChannel)
+
+TRACE_DECLARE_INT_COUNTER(JsonAsAssetFilesParsed, TEXT("JsonAsAsset/Files Parsed"));
+TRACE_DECLARE_INT_COUNTER(JsonAsAssetAssetsImported, TEXT("JsonAsAsset/Assets Imported"));
+TRACE_DECLARE_INT_COUNTER(JsonAsAssetPropertiesDeserialized, TEXT("JsonAsAsset/Properties Deserialized"));
+TRACE_DECLARE_INT_COUNTER(JsonAsAssetReferencesLoaded, TEXT("JsonAsAsset/References Loaded"));
+TRACE_DECLARE_INT_COUNTER(JsonAsAssetTexturesDecompressed, TEXT("JsonAsAsset/Textures Decompressed"));
+TRACE_DECLARE_INT_COUNTER(JsonAsAssetRemoteRequests, TEXT("JsonAsAsset/Remote Requests"));
+TRACE_DECLARE_INT_COUNTER(JsonAsAssetPackagesSaved, TEXT("JsonAsAsset/Packages Saved"));
+TRACE_DECLARE_INT_COUNTER(JsonAsAssetMaterialBatchesCompiled, TEXT("JsonAsAsset/Material Batches Compiled"));
+TRACE_DECLARE_INT_COUNTER(JsonAsAssetAnimationsCompressed, TEXT("JsonAsAsset/Animations Compressed"));
+
+namespace {
+	constexpr int32 GPhaseCount = static_cast<int32>(EImportTracePhase::Count);
+
+	/* Added to from worker threads while properties deserialize in parallel */
+	std::atomic<uint64> GPhaseCycles[GPhaseCount];
+
+	/* How deep the calling thread is in every phase */
+	thread_local int32 GPhaseDepth[GPhaseCount];
+}
+
+FImportTrace::FPhaseScope::FPhaseScope(const EImportTracePhase InPhase)
+	: Phase(InPhase), StartCycles(0), bOutermost(GPhaseDepth[static_cast<int32>(InPhase)]++ == 0)
+{
+	/* Counters aren't atomic, work on worker threads is counted by whoever dispatched it */
+	if (IsInGameThread()) {
+		switch (Phase) {
+			case EImportTracePhase::ParseJson: TRACE_COUNTER_INCREMENT(JsonAsAssetFilesParsed); break;
+			case EImportTracePhase::Import: TRACE_COUNTER_INCREMENT(JsonAsAssetAssetsImported); break;
+			case EImportTracePhase::DeserializeProperties: TRACE_COUNTER_INCREMENT(JsonAsAssetPropertiesDeserialized); break;
+			case EImportTracePhase::LoadReferences: TRACE_COUNTER_INCREMENT(JsonAsAssetReferencesLoaded); break;
+			case EImportTracePhase::DecompressTextures: TRACE_COUNTER_INCREMENT(JsonAsAssetTexturesDecompressed); break;
+			case EImportTracePhase::RemoteRequests: TRACE_COUNTER_INCREMENT(JsonAsAssetRemoteRequests); break;
+			case EImportTracePhase::SavePackages: TRACE_COUNTER_INCREMENT(JsonAsAssetPackagesSaved); break;
+			case EImportTracePhase::CompileMaterials: TRACE_COUNTER_INCREMENT(JsonAsAssetMaterialBatchesCompiled); break;
+			case EImportTracePhase::CompressAnimations: TRACE_COUNTER_INCREMENT(JsonAsAssetAnimationsCompressed); break;
+			default: break;
+		}
+	}
+
+	if (bOutermost) {
+		StartCycles = FPlatformTime::Cycles64();
+	}
+}
+
+FImportTrace::FPhaseScope::~FPhaseScope() {
+	const int32 Index = static_cast<int32>(Phase);
+	GPhaseDepth[Index]--;
+
+	if (bOutermost) {
+		GPhaseCycles[Index].fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+	}
+}
+
+FImportTrace::FSnapshot FImportTrace::TakeSnapshot() {
+	FSnapshot Snapshot;
+
+	for (int32 Index = 0; Index < GPhaseCount; Index++) {
+		Snapshot.Cycles[Index] = GPhaseCycles[Index].load(std::memory_order_relaxed);
+	}
+
+	return Snapshot;
+}
+
+TMap<FString, double> FImportTrace::GetSecondsSince(const FSnapshot& Snapshot) {
+	TMap<FString, double> Seconds;
+
+	for (int32 Index = 0; Index < GPhaseCount; Index++) {
+		const uint64 Cycles = GPhaseCycles[Index].load(std::memory_order_relaxed) - Snapshot.Cycles[Index];
+
+		if (Cycles > 0) {
+			Seconds.Add(PhaseToString(static_cast<EImportTracePhase>(Index)), FPlatformTime::ToSeconds64(Cycles));
+		}
+	}
+
+	return Seconds;
+}
+
+void FImportTrace::CountPropertiesDeserialized(const int32 Num) {
+	TRACE_COUNTER_ADD(JsonAsAssetPropertiesDeserialized, Num);
+}
+
+const TCHAR* FImportTrace::PhaseToString(const EImportTracePhase Phase) {
+	switch (Phase) {
+		case EImportTracePhase::ParseJson: return TEXT("ParseJson");
+		case EImportTracePhase::Import: return TEXT("Import");
+		case EImportTracePhase::DeserializeExports: return TEXT("DeserializeExports");
+		case EImportTracePhase::DeserializeProperties: return TEXT("DeserializeProperties");
+		case EImportTracePhase::LoadReferences: return TEXT("LoadReferences");
+		case EImportTracePhase::DecompressTextures: return TEXT("DecompressTextures");
+		case EImportTracePhase::RemoteRequests: return TEXT("RemoteRequests");
+		case EImportTracePhase::SavePackages: return TEXT("SavePackages");
+		case EImportTracePhase::CompileMaterials: return TEXT("CompileMaterials");
+		case EImportTracePhase::ImportCurves: return TEXT("ImportCurves");
+		case EImportTracePhase::CompressAnimations: return TEXT("CompressAnimations");
+		default: return TEXT("Unknown");
+	}
+}
@@ -0,0 +1,145 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/MaterialCompileBatch.h"
+
+#include "Importers/Constructor/Importer.h"
+#include "Modules/LogCategory.h"
+#include "Utilities/ImportTrace.h"
+
+#include "Algo/StableSort.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialFunctionInterface.h"
+#include "Materials/MaterialInstance.h"
+#include "ShaderCompiler.h"
+
+namespace {
+	struct FDeferredCompile {
+		TWeakObjectPtr<UObject> Asset;
+		TArray<FMaterialCompileBatch::FWork> Work;
+	};
+
+	int32 GBatchDepth = 0;
+
+	/* In the order assets were first deferred */
+	TArray<FDeferredCompile> GDeferredCompiles;
+}
+
+/* Functions first, then materials, then instances below their parents */
+static int32 GetCompileRank(const UObject* Asset) {
+	if (Asset->IsA<UMaterialFunctionInterface>()) return 0;
+	if (Asset->IsA<UMaterial>()) return 1;
+
+	int32 Rank = 2;
+
+	for (const UMaterialInstance* Instance = Cast<UMaterialInstance>(Asset); Instance != nullptr; Instance = Cast<UMaterialInstance>(Instance->Parent)) {
+		Rank++;
+	}
+
+	return Rank;
+}
+
+void FMaterialCompileBatch::Begin() {
+	check(IsInGameThread());
+
+	GBatchDepth++;
+}
+
+double FMaterialCompileBatch::End() {
+	check(IsInGameThread());
+
+	if (GBatchDepth == 0 || --GBatchDepth > 0) {
+		return 0.0;
+	}
+
+	TArray<FDeferredCompile> Compiles = MoveTemp(GDeferredCompiles);
+	GDeferredCompiles.Reset();
+
+	Compiles.RemoveAll([](const FDeferredCompile& Compile) {
+		return !Compile.Asset.IsValid();
+	});
+
+	if (Compiles.Num() == 0) {
+		return 0.0;
+	}
+
+	JSONASASSET_TRACE_SCOPE("CompileMaterials", CompileMaterials)
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	/* Stable, so functions using other functions keep their import order */
+	Algo::StableSortBy(Compiles, [](const FDeferredCompile& Compile) {
+		return GetCompileRank(Compile.Asset.Get());
+	});
+
+	int32 Functions = 0, Materials = 0, Instances = 0;
+
+	{
+		/* Render states are recreated once, for every material of the batch */
+		FMaterialUpdateContext UpdateContext;
+
+		for (const FDeferredCompile& Compile : Compiles) {
+			UObject* Asset = Compile.Asset.Get();
+
+			for (const FWork& Work : Compile.Work) {
+				Work(UpdateContext);
+			}
+
+			if (UMaterial* Material = Cast<UMaterial>(Asset)) {
+				UpdateContext.AddMaterial(Material);
+				Materials++;
+			} else if (UMaterialInstance* Instance = Cast<UMaterialInstance>(Asset)) {
+				UpdateContext.AddMaterialInstance(Instance);
+				Instances++;
+			} else {
+				Functions++;
+			}
+
+			Asset->PreEditChange(nullptr);
+			Asset->PostEditChange();
+		}
+	}
+
+	/* Shaders compile asynchronously, the time includes waiting for all of them */
+	if (GShaderCompilingManager != nullptr) {
+		GShaderCompilingManager->FinishAllCompilation();
+	}
+
+	const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+	/* Packages were saved before compiling, instances only have their static permutation now */
+	for (const FDeferredCompile& Compile : Compiles) {
+		Compile.Asset->MarkPackageDirty();
+		IImporter::SavePackage(Compile.Asset->GetOutermost());
+	}
+
+	UE_LOG(LogJsonAsAsset, Log, TEXT("Compiled %d material functions, %d materials and %d material instances in %.2f seconds"), Functions, Materials, Instances, Seconds);
+
+	return Seconds;
+}
+
+bool FMaterialCompileBatch::IsActive() {
+	return GBatchDepth > 0;
+}
+
+bool FMaterialCompileBatch::Defer(UObject* Asset, FWork Work) {
+	if (!IsActive() || Asset == nullptr) return false;
+
+	if (!Asset->IsA<UMaterial>() && !Asset->IsA<UMaterialFunctionInterface>() && !Asset->IsA<UMaterialInstance>()) {
+		return false;
+	}
+
+	FDeferredCompile* Compile = GDeferredCompiles.FindByPredicate([Asset](const FDeferredCompile& Deferred) {
+		return Deferred.Asset.Get() == Asset;
+	});
+
+	if (Compile == nullptr) {
+		Compile = &GDeferredCompiles.AddDefaulted_GetRef();
+		Compile->Asset = Asset;
+	}
+
+	if (Work) {
+		Compile->Work.Add(MoveTemp(Work));
+	}
+
+	return true;
+}
@@ -5,6 +5,7 @@
 #include "HttpManager.h"
 #include "HttpModule.h"
 #include "Modules/LogCategory.h"
+#include "Utilities/ImportTrace.h"
 #include "Serialization/JsonSerializer.h"
 
 #if ENGINE_UE5
@@ -13,6 +14,8 @@ TSharedPtr<IHttpResponse> FRemoteUtilities::ExecuteRequestSync(TSharedRef<IHttpR
 TSharedPtr<IHttpResponse, ESPMode::ThreadSafe> FRemoteUtilities::ExecuteRequestSync(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest, float LoopDelay)
 #endif
 {
+	JSONASASSET_TRACE_SCOPE("ExecuteRequestSync", RemoteRequests)
+
 	const bool bStartedRequest = HttpRequest->ProcessRequest();
 	if (!bStartedRequest)
 	{
@@ -10,8 +10,13 @@
 #endif
 
 #include "Utilities/Serializers/PropertyUtilities.h"
+#include "Components/StaticMeshComponent.h"
+#include "Rendering/ColorVertexBuffer.h"
+#include "RenderingThread.h"
 #include "UObject/Package.h"
 #include "Utilities/EngineUtilities.h"
+#include "Utilities/ImportTrace.h"
+#include "Utilities/TypeResolver.h"
 
 /* ReSharper disable once CppDeclaratorNeverUsed */
 DECLARE_LOG_CATEGORY_CLASS(LogJsonAsAssetObjectSerializer, All, All);
@@ -50,7 +55,14 @@ void UObjectSerializer::SetExportForDeserialization(const TSharedPtr<FJsonObject
 	ConstructedObjects.Add(JsonObject->GetStringField(TEXT("Name")), Object);
 }
 
+void UObjectSerializer::BeginPropertyDelta() {
+	bApplyPropertyDelta = true;
+	ChangedPropertyCount = 0;
+}
+
 void UObjectSerializer::DeserializeExports(TArray<TSharedPtr<FJsonValue>> InExports) {
+	JSONASASSET_TRACE_SCOPE("DeserializeExports", DeserializeExports)
+
 	PropertySerializer->ExportsContainer.Empty();
 	
 	TMap<TSharedPtr<FJsonObject>, UObject*> ExportsMap;
@@ -81,12 +93,17 @@ void UObjectSerializer::DeserializeExports(TArray<TSharedPtr<FJsonValue>> InExpo
 		DeserializeExport(Export, ExportsMap);
 	}
 
+	/* Vertex color buffers are initialized once every component has been deserialized */
+	TGuardValue<bool> DeferVertexColors(bDeserializingExports, true);
+
 	for (const auto Pair : ExportsMap) {
 		TSharedPtr<FJsonObject> Properties = Pair.Key;
 		UObject* Object = Pair.Value;
 
 		DeserializeObjectProperties(Properties, Object);
 	}
+
+	InitPendingVertexColors();
 }
 
 void UObjectSerializer::DeserializeExport(FUObjectExport& Export, TMap<TSharedPtr<FJsonObject>, UObject*>& ExportsMap) {
@@ -111,18 +128,10 @@ void UObjectSerializer::DeserializeExport(FUObjectExport& Export, TMap<TSharedPt
 		ClassName = ReadPathFromObject(&TemplateObject).Replace(TEXT("Default__"), TEXT(""));
 	}
 
-#if UE5_6_BEYOND
-	UClass* Class = FindFirstObject<UClass>(*ClassName);
-#else
-	UClass* Class = FindObject<UClass>(ANY_PACKAGE, *ClassName);
-#endif
+	UClass* Class = FTypeResolver::FindClass(ClassName);
 	
 	if (!Class) {
-#if UE5_6_BEYOND
-		Class = FindFirstObject<UClass>(*Type);
-#else
-		Class = FindObject<UClass>(ANY_PACKAGE, *Type);
-#endif
+		Class = FTypeResolver::FindClass(Type);
 	}
 
 	if (!Class) return;
@@ -148,7 +157,13 @@ void UObjectSerializer::DeserializeExport(FUObjectExport& Export, TMap<TSharedPt
 		ObjectOuter = Parent;
 	}
 
-	UObject* NewUObject = NewObject<UObject>(ObjectOuter, Class, FName(*Name));
+	/* When reimporting, keep the existing subobject so only its changed properties are written */
+	UObject* NewUObject = bApplyPropertyDelta ? StaticFindObjectFast(Class, ObjectOuter, FName(*Name), true) : nullptr;
+
+	if (NewUObject == nullptr) {
+		NewUObject = NewObject<UObject>(ObjectOuter, Class, FName(*Name));
+		ChangedPropertyCount++;
+	}
 
 	if (ExportObject->HasField(TEXT("Properties"))) {
 		TSharedPtr<FJsonObject> Properties = ExportObject->GetObjectField(TEXT("Properties"));
@@ -170,13 +185,29 @@ void UObjectSerializer::DeserializeObjectProperties(const TSharedPtr<FJsonObject
 
 	const UClass* ObjectClass = Object->GetClass();
 
+	/* Plain data is written in parallel once every reference has been resolved */
+	TArray<FPlainDataPropertyWrite> PlainDataWrites;
+
 	for (FProperty* Property = ObjectClass->PropertyLink; Property; Property = Property->PropertyLinkNext) {
 		const FString PropertyName = Property->GetName();
 
 		if (!PropertySerializer->ShouldDeserializeProperty(Property)) continue;
 
 		void* PropertyValue = Property->ContainerPtrToValuePtr<void>(Object);
-		const bool HasHandledProperty = PassthroughPropertyHandler(Property, PropertyName, PropertyValue, Properties, PropertySerializer);
+		bool HasHandledProperty = false;
+
+		/* Static arrays are compared as a whole when reimporting */
+		if (bApplyPropertyDelta && Property->ArrayDim != 1) {
+			if (WritePropertyDelta(Property, PropertyValue, [&](void* ScratchValue) {
+				HasHandledProperty = PassthroughPropertyHandler(Property, PropertyName, ScratchValue, Properties, PropertySerializer);
+			})) {
+				ChangedPropertyCount++;
+			}
+		} else {
+			HasHandledProperty = PassthroughPropertyHandler(Property, PropertyName, PropertyValue, Properties, PropertySerializer);
+
+			if (HasHandledProperty) ChangedPropertyCount++;
+		}
 
 		/* Handler Specifically for Animation Blueprint Graph Nodes */
 		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property)) {
@@ -184,7 +215,16 @@ void UObjectSerializer::DeserializeObjectProperties(const TSharedPtr<FJsonObject
 				void* StructPtr = StructProperty->ContainerPtrToValuePtr<void>(Object);
 
 				if (static_cast<FAnimNode_Base*>(StructPtr)) {
-					PropertySerializer->DeserializeStruct(StructProperty->Struct, Properties.ToSharedRef(), PropertyValue);
+					if (bApplyPropertyDelta) {
+						if (WritePropertyDelta(Property, PropertyValue, [&](void* ScratchValue) {
+							PropertySerializer->DeserializeStruct(StructProperty->Struct, Properties.ToSharedRef(), ScratchValue);
+						})) {
+							ChangedPropertyCount++;
+						}
+					} else {
+						PropertySerializer->DeserializeStruct(StructProperty->Struct, Properties.ToSharedRef(), PropertyValue);
+						ChangedPropertyCount++;
+					}
 				}
 			}
 		}
@@ -192,57 +232,186 @@ void UObjectSerializer::DeserializeObjectProperties(const TSharedPtr<FJsonObject
 		if (Properties->HasField(PropertyName) && !HasHandledProperty && PropertyName != "LODParentPrimitive") {
 			const TSharedPtr<FJsonValue>& ValueObject = Properties->Values.FindChecked(PropertyName);
 
-			if (Property->ArrayDim == 1 || ValueObject->Type == EJson::Array) {
+			if (bApplyPropertyDelta) {
+				if (DeserializePropertyDelta(Property, ValueObject, PropertyValue)) {
+					UE_LOG(LogJsonAsAssetObjectSerializer, Verbose, TEXT("Property changed: %s.%s"), *Object->GetName(), *PropertyName);
+					ChangedPropertyCount++;
+				}
+			} else if (PropertySerializer->IsPlainDataProperty(Property)) {
+				PlainDataWrites.Add({ Property, ValueObject, PropertyValue });
+				ChangedPropertyCount++;
+			} else if (Property->ArrayDim == 1 || ValueObject->Type == EJson::Array) {
 				PropertySerializer->DeserializePropertyValue(Property, ValueObject.ToSharedRef(), PropertyValue);
+				ChangedPropertyCount++;
 			}
 		}
 	}
 
+	PropertySerializer->DeserializePlainDataProperties(PlainDataWrites);
+
+	if (bApplyPropertyDelta) {
+		ResetMissingProperties(Properties, Object);
+	}
+
 	/* this is a use case for importing maps and parsing static mesh components
 	 * using the object and property serializer, this was initially wanted to be
 	 * done completely without any manual work (using the de-serializers)
 	 * however I don't think it's possible to do so. as I haven't seen any native
 	 * property that can do this using the data provided in CUE4Parse
 	 */
-	if (Properties->HasField(TEXT("LODData")) && Cast<UStaticMeshComponent>(Object)) {
-		UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Object);
-		if (!StaticMeshComponent) return;
-		
-		TArray<TSharedPtr<FJsonValue>> ObjectLODData = Properties->GetArrayField(TEXT("LODData"));
-		int CurrentLOD = -1;
-		
-		for (const TSharedPtr<FJsonValue> CurrentLODValue : ObjectLODData) {
-			CurrentLOD++;
+	if (Properties->HasField(TEXT("LODData"))) {
+		if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Object)) {
+			DeserializeVertexColors(Properties->GetArrayField(TEXT("LODData")), StaticMeshComponent);
+		}
+	}
+}
+
+void UObjectSerializer::DeserializeVertexColors(const TArray<TSharedPtr<FJsonValue>>& ObjectLODData, UStaticMeshComponent* StaticMeshComponent) const {
+	const double StartTime = FPlatformTime::Seconds();
+	int32 NumDecodedVertices = 0;
+	bool bChanged = false;
 
-			const TSharedPtr<FJsonObject> CurrentLODObject = CurrentLODValue->AsObject();
+	for (int32 LODIndex = 0; LODIndex < ObjectLODData.Num(); LODIndex++) {
+		const TSharedPtr<FJsonObject> CurrentLODObject = ObjectLODData[LODIndex]->AsObject();
 
-			/* Must contain vertex colors, or else it's an empty LOD */
-			if (!CurrentLODObject->HasField(TEXT("OverrideVertexColors"))) continue;
+		/* Must contain vertex colors, or else it's an empty LOD */
+		const TSharedPtr<FJsonObject>* OverrideVertexColorsObject;
+		if (!CurrentLODObject.IsValid() || !CurrentLODObject->TryGetObjectField(TEXT("OverrideVertexColors"), OverrideVertexColorsObject)) continue;
 
-			const TSharedPtr<FJsonObject> OverrideVertexColorsObject = CurrentLODObject->GetObjectField(TEXT("OverrideVertexColors"));
+		const TArray<TSharedPtr<FJsonValue>>* DataArray;
+		if (!(*OverrideVertexColorsObject)->TryGetArrayField(TEXT("Data"), DataArray)) continue;
 
-			if (!OverrideVertexColorsObject->HasField(TEXT("Data"))) continue;
+		/* A missing or negative count would turn into a huge allocation */
+		const int32 NumVertices = FMath::Max(0, (*OverrideVertexColorsObject)->GetIntegerField(TEXT("NumVertices")));
+		if (NumVertices == 0) continue;
 
-			const int32 NumVertices = OverrideVertexColorsObject->GetIntegerField(TEXT("NumVertices"));
-			const TArray<TSharedPtr<FJsonValue>> DataArray = OverrideVertexColorsObject->GetArrayField(TEXT("Data"));
+		if (StaticMeshComponent->LODData.Num() <= LODIndex) {
+			StaticMeshComponent->SetLODDataCount(LODIndex + 1, LODIndex + 1);
+		}
 
-			/* Template of the target data */
-			FString Output = FString::Printf(TEXT("CustomLODData LOD=%d, ColorVertexData(%d)=("), CurrentLOD, NumVertices);
+		FStaticMeshComponentLODInfo& LODInfo = StaticMeshComponent->LODData[LODIndex];
 
-			/* Append the colors in the expected format */
-			for (int32 i = 0; i < DataArray.Num(); ++i) {
-				FString ColorValue = DataArray.operator[](i)->AsString();
-				Output.Append(ColorValue);
+		/* Colors are packed ARGB hex strings, the same ones FColorVertexBuffer::ImportText reads */
+		FColorVertexBuffer* ColorVertexBuffer = new FColorVertexBuffer;
+		ColorVertexBuffer->Init(NumVertices);
 
-				/* Add a comma unless it's the last element */
-				if (i < DataArray.Num() - 1) {
-					Output.Append(TEXT(","));
-				}
+		const int32 NumColors = FMath::Min(NumVertices, DataArray->Num());
+
+		for (int32 VertexIndex = 0; VertexIndex < NumColors; VertexIndex++) {
+			ColorVertexBuffer->VertexColor(VertexIndex) = FColor(FParse::HexNumber(*(*DataArray)[VertexIndex]->AsString()));
+		}
+
+		/* Init leaves the buffer uninitialized, vertices without a color are white (no override) */
+		for (int32 VertexIndex = NumColors; VertexIndex < NumVertices; VertexIndex++) {
+			ColorVertexBuffer->VertexColor(VertexIndex) = FColor::White;
+		}
+
+		/* Reimporting the same colors leaves the existing buffer (and the component) untouched */
+		if (bApplyPropertyDelta && LODInfo.OverrideVertexColors != nullptr && LODInfo.OverrideVertexColors->GetNumVertices() == ColorVertexBuffer->GetNumVertices()
+			&& LODInfo.OverrideVertexColors->GetVertexData() != nullptr && FMemory::Memcmp(LODInfo.OverrideVertexColors->GetVertexData(), ColorVertexBuffer->GetVertexData(), ColorVertexBuffer->GetNumVertices() * sizeof(FColor)) == 0) {
+			delete ColorVertexBuffer;
+			continue;
+		}
+
+		if (LODInfo.OverrideVertexColors != nullptr) {
+			LODInfo.ReleaseOverrideVertexColorsAndBlock();
+		}
+
+		LODInfo.OverrideVertexColors = ColorVertexBuffer;
+		NumDecodedVertices += NumVertices;
+		ChangedPropertyCount++;
+		bChanged = true;
+	}
+
+	/* LODs the export doesn't have are removed */
+	if (StaticMeshComponent->LODData.Num() > ObjectLODData.Num()) {
+		StaticMeshComponent->SetLODDataCount(ObjectLODData.Num(), ObjectLODData.Num());
+		ChangedPropertyCount++;
+		bChanged = true;
+	}
+
+	if (!bChanged) return;
+
+	PendingVertexColorComponents.AddUnique(StaticMeshComponent);
+
+	UE_LOG(LogJsonAsAssetObjectSerializer, Verbose, TEXT("%s: decoded %d vertex colors in %.3f ms"),
+		*StaticMeshComponent->GetName(), NumDecodedVertices, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	/* Outside of DeserializeExports there's no later point to batch them at */
+	if (!bDeserializingExports) {
+		InitPendingVertexColors();
+	}
+}
+
+void UObjectSerializer::InitPendingVertexColors() const {
+	for (const TWeakObjectPtr<UStaticMeshComponent>& Component : PendingVertexColorComponents) {
+		UStaticMeshComponent* StaticMeshComponent = Component.Get();
+		if (StaticMeshComponent == nullptr) continue;
+
+		for (FStaticMeshComponentLODInfo& LODInfo : StaticMeshComponent->LODData) {
+			if (LODInfo.OverrideVertexColors != nullptr && !LODInfo.OverrideVertexColors->IsInitialized()) {
+				BeginInitResource(LODInfo.OverrideVertexColors);
 			}
+		}
 
-			Output.Append(TEXT(")"));
-		
-			StaticMeshComponent->ImportCustomProperties(*Output, GWarn);
+		StaticMeshComponent->MarkRenderStateDirty();
+	}
+
+	PendingVertexColorComponents.Reset();
+}
+
+bool UObjectSerializer::DeserializePropertyDelta(FProperty* Property, const TSharedPtr<FJsonValue>& Value, void* PropertyValue) const {
+	return WritePropertyDelta(Property, PropertyValue, [this, Property, &Value](void* ScratchValue) {
+		PropertySerializer->DeserializePropertyValue(Property, Value.ToSharedRef(), ScratchValue);
+	});
+}
+
+bool UObjectSerializer::WritePropertyDelta(FProperty* Property, void* PropertyValue, const TFunctionRef<void(void*)> Write) const {
+	/* Write into a copy of the current value (every static array element), and only copy it back if it differs */
+	void* ScratchValue = FMemory::Malloc(Property->GetSize(), Property->GetMinAlignment());
+	Property->InitializeValue(ScratchValue);
+	Property->CopyCompleteValue(ScratchValue, PropertyValue);
+
+	Write(ScratchValue);
+
+	bool bChanged = false;
+
+	for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim && !bChanged; ArrayIndex++) {
+		const int32 Offset = GetElementSize(Property) * ArrayIndex;
+
+		bChanged = !Property->Identical(static_cast<uint8*>(PropertyValue) + Offset, static_cast<uint8*>(ScratchValue) + Offset, PPF_None);
+	}
+
+	if (bChanged) {
+		Property->CopyCompleteValue(PropertyValue, ScratchValue);
+	}
+
+	Property->DestroyValue(ScratchValue);
+	FMemory::Free(ScratchValue);
+
+	return bChanged;
+}
+
+void UObjectSerializer::ResetMissingProperties(const TSharedPtr<FJsonObject>& Properties, UObject* Object) const {
+	const UObject* Archetype = Object->GetArchetype();
+	if (Archetype == nullptr || !Archetype->IsA(Object->GetClass())) return;
+
+	/* Instanced objects belong to the asset, copying the archetype's pointer would share them */
+	constexpr EPropertyFlags SkippedFlags = CPF_Transient | CPF_DuplicateTransient | CPF_NonPIEDuplicateTransient | CPF_InstancedReference | CPF_ContainsInstancedReference;
+
+	for (FProperty* Property = Object->GetClass()->PropertyLink; Property; Property = Property->PropertyLinkNext) {
+		if (Property->HasAnyPropertyFlags(SkippedFlags)) continue;
+		if (!PropertySerializer->ShouldDeserializeProperty(Property)) continue;
+		if (Properties->HasField(Property->GetName())) continue;
+
+		bool bIdentical = true;
+		for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim && bIdentical; ArrayIndex++) {
+			bIdentical = Property->Identical_InContainer(Object, Archetype, ArrayIndex);
+		}
+
+		if (!bIdentical) {
+			Property->CopyCompleteValue_InContainer(Object, Archetype);
+			ChangedPropertyCount++;
 		}
 	}
 }
@@ -3,7 +3,11 @@
 #include "Utilities/Serializers/PropertyUtilities.h"
 
 #include "GameplayTagContainer.h"
+#include "Animation/AnimNodeBase.h"
+#include "Async/ParallelFor.h"
+#include "Misc/PackageName.h"
 #include "Importers/Constructor/Importer.h"
+#include "Utilities/ImportTrace.h"
 #include "Utilities/Serializers/ObjectUtilities.h"
 #include "UObject/TextProperty.h"
 
@@ -13,6 +17,12 @@
 #include "Utilities/Serializers/Structs/TimespanSerializer.h"
 
 DECLARE_LOG_CATEGORY_CLASS(LogJsonAsAssetPropertySerializer, Error, Log);
+
+/*
+ * Plain data writes handed to a task at once. A write parses one json value (tens of nanoseconds),
+ * a task costs a few microseconds to schedule, so a batch has to hold enough of them to be worth one.
+ */
+static constexpr int32 GPlainDataBatchSize = 64;
 PRAGMA_DISABLE_OPTIMIZATION
 
 UPropertySerializer::UPropertySerializer() {
@@ -28,6 +38,8 @@ UPropertySerializer::UPropertySerializer() {
 }
 
 void UPropertySerializer::DeserializePropertyValue(FProperty* Property, const TSharedRef<FJsonValue>& JsonValue, void* OutValue) {
+	JSONASASSET_TRACE_SCOPE("DeserializePropertyValue", DeserializeProperties)
+
 	const FMapProperty* MapProperty = CastField<const FMapProperty>(Property);
 	const FSetProperty* SetProperty = CastField<const FSetProperty>(Property);
 	const FArrayProperty* ArrayProperty = CastField<const FArrayProperty>(Property);
@@ -117,17 +129,7 @@ void UPropertySerializer::DeserializePropertyValue(FProperty* Property, const TS
 			FSoftObjectPtr* ObjectPtr = static_cast<FSoftObjectPtr*>(OutValue);
 			*ObjectPtr = FSoftObjectPath(PathString);
 
-			if (!ObjectPtr->LoadSynchronous()) {
-				/* Try importing it using Cloud */
-				FString PackagePath;
-				FString AssetName;
-				PathString.Split(".", &PackagePath, &AssetName);
-				TObjectPtr<UObject> T;
-
-				FString PropertyClassName = SoftObjectProperty->PropertyClass->GetName();
-				
-				IImporter::DownloadWrapper(T, PropertyClassName, AssetName, PackagePath);
-			}
+			ReferenceResolver.ResolveSoftPath(PathString, SoftObjectProperty->PropertyClass->GetName());
 		}
 	}
 	else if (const FObjectPropertyBase* ObjectProperty = CastField<const FObjectPropertyBase>(Property)) {
@@ -140,14 +142,31 @@ void UPropertySerializer::DeserializePropertyValue(FProperty* Property, const TS
 
 		if (NewJsonValue->Type == EJson::Object) {
 			auto JsonValueAsObject = NewJsonValue->AsObject();
+
+			/* Class'Asset:ExportName' of a subobject in the local graph */
+			if (LocalExports != nullptr) {
+				FString AssetName, ExportName;
+
+				if (JsonValueAsObject->GetStringField(TEXT("ObjectName")).Split(":", &AssetName, &ExportName)) {
+					AssetName.Split("'", nullptr, &AssetName);
+					AssetName.Split(".", nullptr, &AssetName, ESearchCase::IgnoreCase, ESearchDir::FromEnd);
+					ExportName.Split("'", &ExportName, nullptr);
+
+					UObject* LocalObject = LocalExports->Find<UObject>(FName(*ExportName));
+
+					/* Other assets' subobjects can have the same name (e.g. in a material function), those are resolved normally */
+					if (LocalObject != nullptr && FPackageName::GetShortName(LocalObject->GetOutermost()->GetName()) == AssetName) {
+						ObjectProperty->SetObjectPropertyValue(OutValue, LocalObject);
+						return;
+					}
+				}
+			}
+
 			bool bUseDefaultLoadObject = !JsonValueAsObject->GetStringField(TEXT("ObjectName")).Contains(":ParticleModule");
 
 			if (bUseDefaultLoadObject) {
-				/* Use IImporter to import the object */
-				IImporter* Importer = new IImporter();
-
-				Importer->ParentObject = ObjectSerializer->Parent;
-				Importer->LoadObject(&JsonValueAsObject, Object);
+				/* Resolved once per unique reference */
+				Object = ReferenceResolver.Resolve(JsonValueAsObject, ObjectSerializer->Parent);
 
 				if (Object == nullptr) {
 					if (ObjectProperty && ObjectProperty->PropertyClass) {
@@ -281,17 +300,7 @@ void UPropertySerializer::DeserializePropertyValue(FProperty* Property, const TS
 				FSoftObjectPtr* ObjectPtr = static_cast<FSoftObjectPtr*>(OutValue);
 				*ObjectPtr = FSoftObjectPath(PathString);
 
-				if (!ObjectPtr->LoadSynchronous()) {
-					/* Try importing it using Cloud */
-					FString PackagePath;
-					FString AssetName;
-					PathString.Split(".", &PackagePath, &AssetName);
-					TObjectPtr<UObject> T;
-
-					FString PropertyClassName = "DataAsset";
-				
-					IImporter::DownloadWrapper(T, PropertyClassName, AssetName, PackagePath);
-				}
+				ReferenceResolver.ResolveSoftPath(PathString, TEXT("DataAsset"));
 			}
 		}
 		
@@ -413,8 +422,104 @@ void UPropertySerializer::DeserializePropertyValue(FProperty* Property, const TS
 	}
 }
 
+bool UPropertySerializer::IsPlainDataProperty(const FProperty* Property) const {
+	check(IsInGameThread());
+
+	if (const bool* bCached = PlainDataProperties.Find(Property)) {
+		return *bCached;
+	}
+
+	/* Assume it isn't while looking, structs can contain arrays of themselves */
+	PlainDataProperties.Add(Property, false);
+
+	bool bPlainData = false;
+
+	if (const FArrayProperty* ArrayProperty = CastField<const FArrayProperty>(Property)) {
+		bPlainData = IsPlainDataProperty(ArrayProperty->Inner);
+	}
+	else if (const FSetProperty* SetProperty = CastField<const FSetProperty>(Property)) {
+		bPlainData = IsPlainDataProperty(SetProperty->ElementProp);
+	}
+	else if (const FMapProperty* MapProperty = CastField<const FMapProperty>(Property)) {
+		bPlainData = IsPlainDataProperty(MapProperty->KeyProp) && IsPlainDataProperty(MapProperty->ValueProp);
+	}
+	else if (const FStructProperty* StructProperty = CastField<const FStructProperty>(Property)) {
+		const UScriptStruct* Struct = StructProperty->Struct;
+
+		/* Structs with special handling resolve tags, paths or objects */
+		bPlainData = Struct != FGameplayTag::StaticStruct()
+			&& Struct != FGameplayTagContainer::StaticStruct()
+			&& Struct->GetFName() != "SoftObjectPath"
+			&& !Struct->IsChildOf(FAnimNode_Base::StaticStruct())
+			&& GetStructSerializer(Struct) == FallbackStructSerializer.Get();
+
+		for (const FProperty* Inner = Struct->PropertyLink; bPlainData && Inner; Inner = Inner->PropertyLinkNext) {
+			bPlainData = IsPlainDataProperty(Inner);
+		}
+	}
+	else {
+		bPlainData = Property->IsA<FNumericProperty>()
+			|| Property->IsA<FBoolProperty>()
+			|| Property->IsA<FStrProperty>()
+			|| Property->IsA<FNameProperty>()
+			|| Property->IsA<FEnumProperty>();
+	}
+
+	/* Static arrays go through PassthroughPropertyHandler on the game thread */
+	bPlainData &= Property->ArrayDim == 1;
+
+	PlainDataProperties.Add(Property, bPlainData);
+
+	return bPlainData;
+}
+
+bool UPropertySerializer::IsPlainDataStruct(const UScriptStruct* Struct) const {
+	check(IsInGameThread());
+
+	if (const bool* bCached = PlainDataStructs.Find(Struct)) {
+		return *bCached;
+	}
+
+	bool bPlainData = GetStructSerializer(Struct) == FallbackStructSerializer.Get();
+
+	for (const FProperty* Property = Struct->PropertyLink; bPlainData && Property; Property = Property->PropertyLinkNext) {
+		bPlainData = IsPlainDataProperty(Property);
+	}
+
+	PlainDataStructs.Add(Struct, bPlainData);
+
+	return bPlainData;
+}
+
+void UPropertySerializer::DeserializePlainDataProperties(const TArray<FPlainDataPropertyWrite>& Writes) {
+	const int32 NumBatches = FMath::DivideAndRoundUp(Writes.Num(), GPlainDataBatchSize);
+
+	/* A single batch isn't worth a task, nested calls from a worker thread just write serially */
+	if (NumBatches < 2 || !IsInGameThread()) {
+		for (const FPlainDataPropertyWrite& Write : Writes) {
+			DeserializePropertyValue(Write.Property, Write.Value.ToSharedRef(), Write.PropertyValue);
+		}
+
+		return;
+	}
+
+	/* Trace counters aren't thread safe, the writes are counted here instead of by each worker */
+	FImportTrace::CountPropertiesDeserialized(Writes.Num());
+
+	ParallelFor(NumBatches, [this, &Writes](const int32 Batch) {
+		const int32 End = FMath::Min((Batch + 1) * GPlainDataBatchSize, Writes.Num());
+
+		for (int32 Index = Batch * GPlainDataBatchSize; Index < End; Index++) {
+			const FPlainDataPropertyWrite& Write = Writes[Index];
+
+			DeserializePropertyValue(Write.Property, Write.Value.ToSharedRef(), Write.PropertyValue);
+		}
+	});
+}
+
 void UPropertySerializer::ClearCachedData() {
 	FailedProperties.Empty();
+	ReferenceResolver.Reset();
 }
 
 void UPropertySerializer::DisablePropertySerialization(UStruct* Struct, const FName PropertyName) {
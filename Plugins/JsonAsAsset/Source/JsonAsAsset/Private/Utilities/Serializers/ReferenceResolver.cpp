@@ -0,0 +1,169 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/Serializers/ReferenceResolver.h"
+
+#include "Importers/Constructor/Importer.h"
+#include "Settings/JsonAsAssetSettings.h"
+#include "Modules/LogCategory.h"
+#include "Utilities/ImportTrace.h"
+
+#include "GameFramework/Actor.h"
+#include "Misc/PackageName.h"
+#include "UObject/UObjectGlobals.h"
+
+FReferenceResolver::FReferenceResolver() {
+}
+
+/* Defined here, IImporter is incomplete in the header */
+FReferenceResolver::~FReferenceResolver() {
+}
+
+/* Recursively collects every object and soft object path inside a json value */
+static void CollectReferencePaths(const TSharedPtr<FJsonValue>& Value, TSet<FString>& OutPaths) {
+	if (!Value.IsValid()) return;
+
+	if (Value->Type == EJson::Array) {
+		for (const TSharedPtr<FJsonValue>& Element : Value->AsArray()) {
+			CollectReferencePaths(Element, OutPaths);
+		}
+
+		return;
+	}
+
+	if (Value->Type != EJson::Object) return;
+
+	for (const auto& Pair : Value->AsObject()->Values) {
+		if (Pair.Value.IsValid() && Pair.Value->Type == EJson::String) {
+			if (Pair.Key == TEXT("ObjectPath") || Pair.Key == TEXT("AssetPathName")) {
+				OutPaths.Add(Pair.Value->AsString());
+			}
+
+			continue;
+		}
+
+		CollectReferencePaths(Pair.Value, OutPaths);
+	}
+}
+
+/* Same conversion IImporter::LoadObject does, but only to the package name */
+FString FReferenceResolver::ToLongPackageName(FString Path) {
+	int32 DotIndex;
+	if (Path.FindChar('.', DotIndex)) {
+		Path.LeftInline(DotIndex);
+	}
+
+	RedirectPath(Path);
+
+	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
+
+	if (!Settings->AssetSettings.GameName.IsEmpty()) {
+		Path = Path.Replace(*(Settings->AssetSettings.GameName + "/Content"), TEXT("/Game"));
+	}
+
+	Path = Path.Replace(TEXT("Engine/Content"), TEXT("/Engine"));
+	Path = Path.Replace(TEXT("//"), TEXT("/"));
+
+	return Path;
+}
+
+int32 FReferenceResolver::PrefetchReferences(const TArray<TSharedPtr<FJsonValue>>& Exports) {
+	JSONASASSET_TRACE_SCOPE("PrefetchReferences", LoadReferences)
+
+	TSet<FString> Paths;
+
+	for (const TSharedPtr<FJsonValue>& Export : Exports) {
+		CollectReferencePaths(Export, Paths);
+	}
+
+	TSet<FString> PackageNames;
+
+	for (const FString& Path : Paths) {
+		const FString PackageName = ToLongPackageName(Path);
+
+		if (PackageName.StartsWith(TEXT("/Script/"))) continue;
+		if (!FPackageName::IsValidLongPackageName(PackageName)) continue;
+
+		PackageNames.Add(PackageName);
+	}
+
+	int32 Requested = 0;
+
+	for (const FString& PackageName : PackageNames) {
+		/* Already in memory (or being imported right now) */
+		if (FindPackage(nullptr, *PackageName) != nullptr) continue;
+
+		/* Doesn't exist locally, resolving will fall back to Cloud */
+		if (!FPackageName::DoesPackageExist(PackageName)) continue;
+
+		LoadPackageAsync(PackageName);
+		Requested++;
+	}
+
+	/* Let the async loader work through the whole batch at once */
+	if (Requested > 0) {
+		FlushAsyncLoading();
+
+		UE_LOG(LogJsonAsAsset, Verbose, TEXT("Prefetched %d referenced packages"), Requested);
+	}
+
+	return Requested;
+}
+
+UObject* FReferenceResolver::Resolve(const TSharedPtr<FJsonObject>& PackageIndex, UObject* ParentObject) {
+	const FString Key = PackageIndex->GetStringField(TEXT("ObjectPath")) + TEXT("|") + PackageIndex->GetStringField(TEXT("ObjectName"));
+
+	/* Components are looked up on the parent actor, that result depends on the parent */
+	const bool bCacheable = ParentObject == nullptr || !ParentObject->IsA(AActor::StaticClass());
+
+	if (bCacheable) {
+		if (UnresolvedReferences.Contains(Key)) {
+			return nullptr;
+		}
+
+		if (const TWeakObjectPtr<UObject>* ResolvedObject = ResolvedObjects.Find(Key)) {
+			if (UObject* Object = ResolvedObject->Get()) {
+				return Object;
+			}
+		}
+	}
+
+	if (!Importer.IsValid()) {
+		Importer = MakeUnique<IImporter>();
+	}
+
+	TObjectPtr<UObject> Object = nullptr;
+
+	Importer->ParentObject = ParentObject;
+	Importer->LoadObject(&PackageIndex, Object);
+
+	if (bCacheable) {
+		if (Object != nullptr) {
+			ResolvedObjects.Add(Key, Object.Get());
+		} else {
+			UnresolvedReferences.Add(Key);
+		}
+	}
+
+	return Object;
+}
+
+void FReferenceResolver::ResolveSoftPath(const FString& Path, const FString& ClassName) {
+	if (ResolvedSoftPaths.Contains(Path)) return;
+	ResolvedSoftPaths.Add(Path);
+
+	if (FSoftObjectPath(Path).TryLoad() != nullptr) return;
+
+	/* Try importing it using Cloud */
+	FString PackagePath;
+	FString AssetName;
+	Path.Split(".", &PackagePath, &AssetName);
+	TObjectPtr<UObject> T;
+
+	IImporter::DownloadWrapper(T, ClassName, AssetName, PackagePath);
+}
+
+void FReferenceResolver::Reset() {
+	ResolvedObjects.Empty();
+	UnresolvedReferences.Empty();
+	ResolvedSoftPaths.Empty();
+}
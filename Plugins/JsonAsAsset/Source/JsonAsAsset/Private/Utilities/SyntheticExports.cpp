@@ -0,0 +1,718 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/SyntheticExports.h"
+
+#include "Settings/JsonAsAssetSettings.h"
+#include "Utilities/Compatibility.h"
+
+#include "Dom/JsonObject.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace {
+	/* The exports of one file, index 0 is the asset itself and is filled in last */
+	struct FSyntheticFile {
+		FString AssetName;
+
+		/* How CUE4Parse writes object paths, e.g. GameName/Content/JsonAsAssetBenchmark/Tables/DT_Benchmark_0 */
+		FString PackagePath;
+
+		TArray<TSharedPtr<FJsonValue>> Exports;
+
+		FSyntheticFile() {
+			Exports.AddDefaulted();
+		}
+
+		int32 AddExport(const FString& Type, const FString& Name, const TSharedRef<FJsonObject>& Properties) {
+			const TSharedRef<FJsonObject> Export = MakeShared<FJsonObject>(); {
+				Export->SetStringField(TEXT("Type"), Type);
+				Export->SetStringField(TEXT("Name"), Name);
+				Export->SetStringField(TEXT("Outer"), AssetName);
+				Export->SetStringField(TEXT("Class"), FString::Printf(TEXT("UScriptClass'%s'"), *Type));
+				Export->SetObjectField(TEXT("Properties"), Properties);
+			}
+
+			return Exports.Add(MakeShared<FJsonValueObject>(Export));
+		}
+
+		void SetAsset(const FString& Type, const TSharedRef<FJsonObject>& Export) {
+			Export->Values.Add(TEXT("Type"), MakeShared<FJsonValueString>(Type));
+			Export->Values.Add(TEXT("Name"), MakeShared<FJsonValueString>(AssetName));
+
+			Exports[0] = MakeShared<FJsonValueObject>(Export);
+		}
+
+		/* A package index pointing at an export of this file */
+		TSharedRef<FJsonObject> Reference(const int32 ExportIndex) const {
+			const TSharedPtr<FJsonObject> Export = Exports[ExportIndex]->AsObject();
+
+			TSharedRef<FJsonObject> Reference = MakeShared<FJsonObject>(); {
+				Reference->SetStringField(TEXT("ObjectName"), FString::Printf(TEXT("%s'%s:%s'"), *Export->GetStringField(TEXT("Type")), *AssetName, *Export->GetStringField(TEXT("Name"))));
+				Reference->SetStringField(TEXT("ObjectPath"), FString::Printf(TEXT("%s.%d"), *PackagePath, ExportIndex));
+			}
+
+			return Reference;
+		}
+
+		TArray<TSharedPtr<FJsonValue>> References(const TArray<int32>& ExportIndices) const {
+			TArray<TSharedPtr<FJsonValue>> Values;
+
+			for (const int32 ExportIndex : ExportIndices) {
+				Values.Add(MakeShared<FJsonValueObject>(Reference(ExportIndex)));
+			}
+
+			return Values;
+		}
+	};
+
+	using FGenerateFunction = int32(*)(FSyntheticFile& File, FRandomStream& Random, int32 Count, const TArray<FSyntheticExport>& Generated);
+
+	struct FSyntheticType {
+		const TCHAR* Type;
+		const TCHAR* Folder;
+		const TCHAR* Prefix;
+
+		/* Element count at scale 1 */
+		int32 BaseCount;
+
+		FGenerateFunction Generate;
+	};
+}
+
+static TSharedRef<FJsonObject> MakeVector(const double X, const double Y, const double Z) {
+	TSharedRef<FJsonObject> Vector = MakeShared<FJsonObject>(); {
+		Vector->SetNumberField(TEXT("X"), X);
+		Vector->SetNumberField(TEXT("Y"), Y);
+		Vector->SetNumberField(TEXT("Z"), Z);
+	}
+
+	return Vector;
+}
+
+/* Rounded, so the files don't depend on how doubles are printed */
+static double RandomValue(FRandomStream& Random, const double Min, const double Max) {
+	return FMath::RoundToDouble(Random.FRandRange(Min, Max) * 1000.0) / 1000.0;
+}
+
+/* Pairs up nodes until one is left, returns the export index of the root */
+static int32 BuildBinaryTree(TArray<int32> Nodes, const TFunctionRef<int32(int32, int32, int32)> Combine) {
+	int32 Depth = 1;
+
+	while (Nodes.Num() > 1) {
+		TArray<int32> Parents;
+
+		for (int32 Index = 0; Index + 1 < Nodes.Num(); Index += 2) {
+			Parents.Add(Combine(Nodes[Index], Nodes[Index + 1], Depth));
+		}
+
+		if (Nodes.Num() % 2 == 1) {
+			Parents.Add(Nodes.Last());
+		}
+
+		Nodes = MoveTemp(Parents);
+		Depth++;
+	}
+
+	return Nodes[0];
+}
+
+/* GameplayTagTableRow rows */
+static int32 GenerateDataTable(FSyntheticFile& File, FRandomStream& Random, const int32 Count, const TArray<FSyntheticExport>&) {
+	const TSharedRef<FJsonObject> RowStruct = MakeShared<FJsonObject>(); {
+		RowStruct->SetStringField(TEXT("ObjectName"), TEXT("ScriptStruct'GameplayTagTableRow'"));
+		RowStruct->SetStringField(TEXT("ObjectPath"), TEXT("/Script/GameplayTags"));
+	}
+
+	const TSharedRef<FJsonObject> Properties = MakeShared<FJsonObject>();
+	Properties->SetObjectField(TEXT("RowStruct"), RowStruct);
+
+	const TSharedRef<FJsonObject> Rows = MakeShared<FJsonObject>();
+
+	for (int32 Row = 0; Row < Count; Row++) {
+		const TSharedRef<FJsonObject> RowObject = MakeShared<FJsonObject>(); {
+			RowObject->SetStringField(TEXT("Tag"), FString::Printf(TEXT("Benchmark.%s.Tag%d"), *File.AssetName, Row));
+			RowObject->SetStringField(TEXT("DevComment"), FString::Printf(TEXT("Synthetic row %d (%d)"), Row, Random.RandRange(0, 1000000)));
+		}
+
+		Rows->SetObjectField(FString::Printf(TEXT("Row_%05d"), Row), RowObject);
+	}
+
+	const TSharedRef<FJsonObject> Export = MakeShared<FJsonObject>(); {
+		Export->SetObjectField(TEXT("Properties"), Properties);
+		Export->SetObjectField(TEXT("Rows"), Rows);
+	}
+
+	File.SetAsset(TEXT("DataTable"), Export);
+
+	return Count;
+}
+
+/* Half the tables use rich curves, the other half simple curves */
+static int32 GenerateCurveTable(FSyntheticFile& File, FRandomStream& Random, const int32 Count, const TArray<FSyntheticExport>&) {
+	constexpr int32 KeysPerCurve = 16;
+	const bool bRichCurves = Random.RandRange(0, 1) == 0;
+
+	const TSharedRef<FJsonObject> Rows = MakeShared<FJsonObject>();
+
+	for (int32 Row = 0; Row < Count; Row++) {
+		TArray<TSharedPtr<FJsonValue>> Keys;
+
+		for (int32 KeyIndex = 0; KeyIndex < KeysPerCurve; KeyIndex++) {
+			const TSharedRef<FJsonObject> Key = MakeShared<FJsonObject>(); {
+				if (bRichCurves) {
+					Key->SetStringField(TEXT("InterpMode"), TEXT("RCIM_Cubic"));
+					Key->SetStringField(TEXT("TangentMode"), TEXT("RCTM_Auto"));
+					Key->SetStringField(TEXT("TangentWeightMode"), TEXT("RCTWM_WeightedNone"));
+				}
+
+				Key->SetNumberField(TEXT("Time"), KeyIndex);
+				Key->SetNumberField(TEXT("Value"), RandomValue(Random, -100.0, 100.0));
+
+				if (bRichCurves) {
+					Key->SetNumberField(TEXT("ArriveTangent"), 0.0);
+					Key->SetNumberField(TEXT("ArriveTangentWeight"), 0.0);
+					Key->SetNumberField(TEXT("LeaveTangent"), 0.0);
+					Key->SetNumberField(TEXT("LeaveTangentWeight"), 0.0);
+				}
+			}
+
+			Keys.Add(MakeShared<FJsonValueObject>(Key));
+		}
+
+		const TSharedRef<FJsonObject> Curve = MakeShared<FJsonObject>(); {
+			Curve->SetArrayField(TEXT("Keys"), Keys);
+
+			if (!bRichCurves) {
+				Curve->SetStringField(TEXT("InterpMode"), TEXT("RCIM_Linear"));
+			}
+
+			Curve->SetNumberField(TEXT("DefaultValue"), 3.4028234663852886e+38);
+			Curve->SetStringField(TEXT("PreInfinityExtrap"), TEXT("RCCE_Constant"));
+			Curve->SetStringField(TEXT("PostInfinityExtrap"), TEXT("RCCE_Constant"));
+		}
+
+		Rows->SetObjectField(FString::Printf(TEXT("Curve_%05d"), Row), Curve);
+	}
+
+	const TSharedRef<FJsonObject> Export = MakeShared<FJsonObject>(); {
+		Export->SetStringField(TEXT("CurveTableMode"), bRichCurves ? TEXT("RichCurves") : TEXT("SimpleCurves"));
+		Export->SetObjectField(TEXT("Rows"), Rows);
+	}
+
+	File.SetAsset(TEXT("CurveTable"), Export);
+
+	return Count;
+}
+
+/* Members cycling through the plain property types, each with a default value and tooltip */
+static int32 GenerateUserDefinedStruct(FSyntheticFile& File, FRandomStream& Random, const int32 Count, const TArray<FSyntheticExport>&) {
+	static const TCHAR* MemberTypes[] = { TEXT("IntProperty"), TEXT("FloatProperty"), TEXT("BoolProperty"), TEXT("StrProperty"), TEXT("NameProperty") };
+
+	TArray<TSharedPtr<FJsonValue>> ChildProperties, PropertiesMetaData;
+	const TSharedRef<FJsonObject> DefaultProperties = MakeShared<FJsonObject>();
+
+	for (int32 Index = 0; Index < Count; Index++) {
+		const FString Type = MemberTypes[Index % UE_ARRAY_COUNT(MemberTypes)];
+
+		/* Cooked member names keep their guid, e.g. Member_3_0A1B2C3D... */
+		const FString Name = FString::Printf(TEXT("Member_%d_%s"), Index, *FGuid(Random.GetUnsignedInt(), Random.GetUnsignedInt(), Random.GetUnsignedInt(), Index).ToString(EGuidFormats::Digits));
+
+		const TSharedRef<FJsonObject> ChildProperty = MakeShared<FJsonObject>(); {
+			ChildProperty->SetStringField(TEXT("Type"), Type);
+			ChildProperty->SetStringField(TEXT("Name"), Name);
+		}
+
+		ChildProperties.Add(MakeShared<FJsonValueObject>(ChildProperty));
+
+		if (Type == TEXT("IntProperty")) {
+			DefaultProperties->SetNumberField(Name, Random.RandRange(-1000, 1000));
+		} else if (Type == TEXT("FloatProperty")) {
+			DefaultProperties->SetNumberField(Name, RandomValue(Random, -100.0, 100.0));
+		} else if (Type == TEXT("BoolProperty")) {
+			DefaultProperties->SetBoolField(Name, Random.RandRange(0, 1) == 1);
+		} else {
+			DefaultProperties->SetStringField(Name, FString::Printf(TEXT("Value%d"), Random.RandRange(0, 1000000)));
+		}
+
+		const TSharedRef<FJsonObject> Tooltip = MakeShared<FJsonObject>(); {
+			Tooltip->SetStringField(TEXT("Key"), TEXT("Tooltip"));
+			Tooltip->SetStringField(TEXT("Value"), FString::Printf(TEXT("Synthetic member %d"), Index));
+		}
+
+		const TSharedRef<FJsonObject> FieldMetaData = MakeShared<FJsonObject>();
+		FieldMetaData->SetArrayField(TEXT("FieldMetaData"), { MakeShared<FJsonValueObject>(Tooltip) });
+
+		const TSharedRef<FJsonObject> Pair = MakeShared<FJsonObject>(); {
+			Pair->SetStringField(TEXT("Key"), Name);
+			Pair->SetObjectField(TEXT("Value"), FieldMetaData);
+		}
+
+		PropertiesMetaData.Add(MakeShared<FJsonValueObject>(Pair));
+	}
+
+	const TSharedRef<FJsonObject> ObjectMetaData = MakeShared<FJsonObject>();
+	ObjectMetaData->SetArrayField(TEXT("ObjectMetaData"), TArray<TSharedPtr<FJsonValue>>());
+
+	const TSharedRef<FJsonObject> StructMetaData = MakeShared<FJsonObject>(); {
+		StructMetaData->SetObjectField(TEXT("ObjectMetaData"), ObjectMetaData);
+		StructMetaData->SetArrayField(TEXT("PropertiesMetaData"), PropertiesMetaData);
+	}
+
+	const TSharedRef<FJsonObject> MetaDataProperties = MakeShared<FJsonObject>();
+	MetaDataProperties->SetObjectField(TEXT("StructMetaData"), StructMetaData);
+
+	File.AddExport(TEXT("StructCookedMetaData"), File.AssetName + TEXT("_CookedMetaData"), MetaDataProperties);
+
+	const TSharedRef<FJsonObject> Export = MakeShared<FJsonObject>(); {
+		Export->SetObjectField(TEXT("Properties"), MakeShared<FJsonObject>());
+		Export->SetArrayField(TEXT("ChildProperties"), ChildProperties);
+		Export->SetObjectField(TEXT("DefaultProperties"), DefaultProperties);
+	}
+
+	File.SetAsset(TEXT("UserDefinedStruct"), Export);
+
+	return Count;
+}
+
+/* Constants combined by a tree of adds and multiplies, the root drives the emissive color */
+static int32 GenerateMaterial(FSyntheticFile& File, FRandomStream& Random, const int32 Count, const TArray<FSyntheticExport>&) {
+	auto MakeInput = [&File](const int32 ExportIndex) {
+		TSharedRef<FJsonObject> Input = MakeShared<FJsonObject>(); {
+			Input->SetObjectField(TEXT("Expression"), File.Reference(ExportIndex));
+			Input->SetNumberField(TEXT("OutputIndex"), 0);
+		}
+
+		return Input;
+	};
+
+	const int32 Constants = FMath::Max(Count / 2 + 1, 1);
+	TArray<int32> Leaves;
+
+	for (int32 Index = 0; Index < Constants; Index++) {
+		const TSharedRef<FJsonObject> Properties = MakeShared<FJsonObject>(); {
+			Properties->SetNumberField(TEXT("R"), RandomValue(Random, 0.0, 1.0));
+			Properties->SetNumberField(TEXT("MaterialExpressionEditorX"), -2000);
+			Properties->SetNumberField(TEXT("MaterialExpressionEditorY"), Index * 80);
+		}
+
+		Leaves.Add(File.AddExport(TEXT("MaterialExpressionConstant"), FString::Printf(TEXT("MaterialExpressionConstant_%d"), Index), Properties));
+	}
+
+	int32 Operators = 0;
+
+	const int32 Root = BuildBinaryTree(Leaves, [&](const int32 A, const int32 B, const int32 Depth) {
+		const FString Type = Operators % 2 == 0 ? TEXT("MaterialExpressionAdd") : TEXT("MaterialExpressionMultiply");
+
+		const TSharedRef<FJsonObject> Properties = MakeShared<FJsonObject>(); {
+			Properties->SetObjectField(TEXT("A"), MakeInput(A));
+			Properties->SetObjectField(TEXT("B"), MakeInput(B));
+			Properties->SetNumberField(TEXT("MaterialExpressionEditorX"), -2000 + Depth * 200);
+			Properties->SetNumberField(TEXT("MaterialExpressionEditorY"), Operators * 80);
+		}
+
+		return File.AddExport(Type, FString::Printf(TEXT("%s_%d"), *Type, Operators++), Properties);
+	});
+
+	const TSharedRef<FJsonObject> Properties = MakeShared<FJsonObject>();
+	Properties->SetObjectField(TEXT("EmissiveColor"), MakeInput(Root));
+
+	const TSharedRef<FJsonObject> Export = MakeShared<FJsonObject>();
+	Export->SetObjectField(TEXT("Properties"), Properties);
+
+	File.SetAsset(TEXT("Material"), Export);
+
+	return File.Exports.Num() - 1;
+}
+
+/* Modulators mixed and concatenated down to one node */
+static int32 GenerateSoundCue(FSyntheticFile& File, FRandomStream& Random, const int32 Count, const TArray<FSyntheticExport>&) {
+	const int32 Modulators = FMath::Max(Count / 2 + 1, 1);
+	TArray<int32> Leaves;
+
+	for (int32 Index = 0; Index < Modulators; Index++) {
+		const TSharedRef<FJsonObject> Properties = MakeShared<FJsonObject>(); {
+			Properties->SetNumberField(TEXT("PitchMin"), RandomValue(Random, 0.8, 1.0));
+			Properties->SetNumberField(TEXT("PitchMax"), RandomValue(Random, 1.0, 1.2));
+			Properties->SetNumberField(TEXT("VolumeMin"), RandomValue(Random, 0.5, 1.0));
+			Properties->SetNumberField(TEXT("VolumeMax"), 1.0);
+		}
+
+		Leaves.Add(File.AddExport(TEXT("SoundNodeModulator"), FString::Printf(TEXT("SoundNodeModulator_%d"), Index), Properties));
+	}
+
+	int32 Parents = 0;
+
+	const int32 Root = BuildBinaryTree(Leaves, [&](const int32 A, const int32 B, int32) {
+		const FString Type = Parents % 2 == 0 ? TEXT("SoundNodeMixer") : TEXT("SoundNodeConcatenator");
+
+		TArray<TSharedPtr<FJsonValue>> InputVolume; {
+			InputVolume.Add(MakeShared<FJsonValueNumber>(1.0));
+			InputVolume.Add(MakeShared<FJsonValueNumber>(1.0));
+		}
+
+		const TSharedRef<FJsonObject> Properties = MakeShared<FJsonObject>(); {
+			Properties->SetArrayField(TEXT("ChildNodes"), File.References({ A, B }));
+			Properties->SetArrayField(TEXT("InputVolume"), InputVolume);
+		}
+
+		return File.AddExport(Type, FString::Printf(TEXT("%s_%d"), *Type, Parents++), Properties);
+	});
+
+	const TSharedRef<FJsonObject> Properties = MakeShared<FJsonObject>();
+	Properties->SetObjectField(TEXT("FirstNode"), File.Reference(Root));
+
+	const TSharedRef<FJsonObject> Export = MakeShared<FJsonObject>();
+	Export->SetObjectField(TEXT("Properties"), Properties);
+
+	File.SetAsset(TEXT("SoundCue"), Export);
+
+	return File.Exports.Num() - 1;
+}
+
+static TSharedRef<FJsonObject> MakeTransform(FRandomStream& Random, const double TranslationRange) {
+	const FQuat Rotation = FRotator(RandomValue(Random, -30.0, 30.0), RandomValue(Random, -30.0, 30.0), RandomValue(Random, -30.0, 30.0)).Quaternion();
+
+	const TSharedRef<FJsonObject> RotationObject = MakeShared<FJsonObject>(); {
+		RotationObject->SetNumberField(TEXT("X"), Rotation.X);
+		RotationObject->SetNumberField(TEXT("Y"), Rotation.Y);
+		RotationObject->SetNumberField(TEXT("Z"), Rotation.Z);
+		RotationObject->SetNumberField(TEXT("W"), Rotation.W);
+	}
+
+	TSharedRef<FJsonObject> Transform = MakeShared<FJsonObject>(); {
+		Transform->SetObjectField(TEXT("Rotation"), RotationObject);
+		Transform->SetObjectField(TEXT("Translation"), MakeVector(RandomValue(Random, -TranslationRange, TranslationRange), RandomValue(Random, -TranslationRange, TranslationRange), RandomValue(Random, -TranslationRange, TranslationRange)));
+		Transform->SetObjectField(TEXT("Scale3D"), MakeVector(1.0, 1.0, 1.0));
+	}
+
+	return Transform;
+}
+
+/* A chain of bones, each parented to the previous one */
+static int32 GenerateSkeleton(FSyntheticFile& File, FRandomStream& Random, const int32 Count, const TArray<FSyntheticExport>&) {
+	TArray<TSharedPtr<FJsonValue>> FinalRefBoneInfo, FinalRefBonePose;
+
+	for (int32 Index = 0; Index < Count; Index++) {
+		const TSharedRef<FJsonObject> BoneInfo = MakeShared<FJsonObject>(); {
+			BoneInfo->SetStringField(TEXT("Name"), FString::Printf(TEXT("bone_%d"), Index));
+			BoneInfo->SetNumberField(TEXT("ParentIndex"), Index - 1);
+		}
+
+		FinalRefBoneInfo.Add(MakeShared<FJsonValueObject>(BoneInfo));
+		FinalRefBonePose.Add(MakeShared<FJsonValueObject>(MakeTransform(Random, 10.0)));
+	}
+
+	const TSharedRef<FJsonObject> ReferenceSkeleton = MakeShared<FJsonObject>(); {
+		ReferenceSkeleton->SetArrayField(TEXT("FinalRefBoneInfo"), FinalRefBoneInfo);
+		ReferenceSkeleton->SetArrayField(TEXT("FinalRefBonePose"), FinalRefBonePose);
+	}
+
+	const TSharedRef<FJsonObject> Export = MakeShared<FJsonObject>(); {
+		Export->SetObjectField(TEXT("Properties"), MakeShared<FJsonObject>());
+		Export->SetObjectField(TEXT("ReferenceSkeleton"), ReferenceSkeleton);
+		Export->SetObjectField(TEXT("AnimRetargetSources"), MakeShared<FJsonObject>());
+	}
+
+	File.SetAsset(TEXT("Skeleton"), Export);
+
+	return Count;
+}
+
+/* Poses of the first generated skeleton, each storing roughly three quarters of its tracks */
+static int32 GeneratePoseAsset(FSyntheticFile& File, FRandomStream& Random, const int32 Count, const TArray<FSyntheticExport>& Generated) {
+	const FSyntheticExport* Skeleton = Generated.FindByPredicate([](const FSyntheticExport& Export) {
+		return Export.Type == TEXT("Skeleton");
+	});
+
+	const int32 NumTracks = Skeleton != nullptr ? Skeleton->ExpectedElements : 128;
+
+	TArray<TSharedPtr<FJsonValue>> Tracks, PoseNames, Poses;
+
+	for (int32 Track = 0; Track < NumTracks; Track++) {
+		Tracks.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("bone_%d"), Track)));
+	}
+
+	for (int32 Index = 0; Index < Count; Index++) {
+		const FString PoseName = FString::Printf(TEXT("Pose_%d"), Index);
+
+#if UE5_3_BEYOND
+		PoseNames.Add(MakeShared<FJsonValueString>(PoseName));
+#else
+		const TSharedRef<FJsonObject> SmartName = MakeShared<FJsonObject>();
+		SmartName->SetStringField(TEXT("DisplayName"), PoseName);
+
+		PoseNames.Add(MakeShared<FJsonValueObject>(SmartName));
+#endif
+
+		TArray<TSharedPtr<FJsonValue>> LocalSpacePose, TrackToBufferIndex;
+
+		for (int32 Track = 0; Track < NumTracks; Track++) {
+			if (Random.RandRange(0, 3) == 0) continue;
+
+			const TSharedRef<FJsonObject> Pair = MakeShared<FJsonObject>(); {
+				Pair->SetNumberField(TEXT("Key"), Track);
+				Pair->SetNumberField(TEXT("Value"), LocalSpacePose.Num());
+			}
+
+			TrackToBufferIndex.Add(MakeShared<FJsonValueObject>(Pair));
+			LocalSpacePose.Add(MakeShared<FJsonValueObject>(MakeTransform(Random, 2.0)));
+		}
+
+		const TSharedRef<FJsonObject> Pose = MakeShared<FJsonObject>(); {
+			Pose->SetArrayField(TEXT("LocalSpacePose"), LocalSpacePose);
+			Pose->SetArrayField(TEXT("TrackToBufferIndex"), TrackToBufferIndex);
+			Pose->SetArrayField(TEXT("CurveData"), TArray<TSharedPtr<FJsonValue>>());
+		}
+
+		Poses.Add(MakeShared<FJsonValueObject>(Pose));
+	}
+
+	const TSharedRef<FJsonObject> PoseContainer = MakeShared<FJsonObject>(); {
+#if UE5_3_BEYOND
+		PoseContainer->SetArrayField(TEXT("PoseFNames"), PoseNames);
+#else
+		PoseContainer->SetArrayField(TEXT("PoseNames"), PoseNames);
+#endif
+		PoseContainer->SetArrayField(TEXT("Tracks"), Tracks);
+		PoseContainer->SetArrayField(TEXT("Poses"), Poses);
+		PoseContainer->SetArrayField(TEXT("Curves"), TArray<TSharedPtr<FJsonValue>>());
+	}
+
+	const TSharedRef<FJsonObject> Properties = MakeShared<FJsonObject>(); {
+		if (Skeleton != nullptr) {
+			const TSharedRef<FJsonObject> SkeletonReference = MakeShared<FJsonObject>(); {
+				SkeletonReference->SetStringField(TEXT("ObjectName"), FString::Printf(TEXT("Skeleton'%s'"), *FPaths::GetBaseFilename(Skeleton->File)));
+				SkeletonReference->SetStringField(TEXT("ObjectPath"), FPaths::GetBaseFilename(Skeleton->ObjectPath, false) + TEXT(".0"));
+			}
+
+			Properties->SetObjectField(TEXT("Skeleton"), SkeletonReference);
+		}
+
+		Properties->SetBoolField(TEXT("bAdditivePose"), false);
+		Properties->SetObjectField(TEXT("PoseContainer"), PoseContainer);
+	}
+
+	const TSharedRef<FJsonObject> Export = MakeShared<FJsonObject>();
+	Export->SetObjectField(TEXT("Properties"), Properties);
+
+	File.SetAsset(TEXT("PoseAsset"), Export);
+
+	return Count;
+}
+
+/* A chain of capsule bodies, each constrained to the previous one */
+static int32 GeneratePhysicsAsset(FSyntheticFile& File, FRandomStream& Random, const int32 Count, const TArray<FSyntheticExport>&) {
+	TArray<int32> Bodies, Constraints;
+	TArray<TSharedPtr<FJsonValue>> CollisionDisableTable;
+
+	for (int32 Index = 0; Index < Count; Index++) {
+		const TSharedRef<FJsonObject> Sphyl = MakeShared<FJsonObject>(); {
+			Sphyl->SetObjectField(TEXT("Center"), MakeVector(0.0, 0.0, RandomValue(Random, -5.0, 5.0)));
+			Sphyl->SetNumberField(TEXT("Radius"), RandomValue(Random, 2.0, 10.0));
+			Sphyl->SetNumberField(TEXT("Length"), RandomValue(Random, 5.0, 30.0));
+		}
+
+		const TSharedRef<FJsonObject> AggGeom = MakeShared<FJsonObject>();
+		AggGeom->SetArrayField(TEXT("SphylElems"), { MakeShared<FJsonValueObject>(Sphyl) });
+
+		const TSharedRef<FJsonObject> Properties = MakeShared<FJsonObject>(); {
+			Properties->SetStringField(TEXT("BoneName"), FString::Printf(TEXT("bone_%d"), Index));
+			Properties->SetObjectField(TEXT("AggGeom"), AggGeom);
+		}
+
+		Bodies.Add(File.AddExport(TEXT("SkeletalBodySetup"), FString::Printf(TEXT("SkeletalBodySetup_%d"), Index), Properties));
+
+		if (Index == 0) continue;
+
+		const TSharedRef<FJsonObject> DefaultInstance = MakeShared<FJsonObject>(); {
+			DefaultInstance->SetStringField(TEXT("JointName"), FString::Printf(TEXT("bone_%d"), Index));
+			DefaultInstance->SetStringField(TEXT("ConstraintBone1"), FString::Printf(TEXT("bone_%d"), Index));
+			DefaultInstance->SetStringField(TEXT("ConstraintBone2"), FString::Printf(TEXT("bone_%d"), Index - 1));
+		}
+
+		const TSharedRef<FJsonObject> ConstraintProperties = MakeShared<FJsonObject>();
+		ConstraintProperties->SetObjectField(TEXT("DefaultInstance"), DefaultInstance);
+
+		Constraints.Add(File.AddExport(TEXT("PhysicsConstraintTemplate"), FString::Printf(TEXT("PhysicsConstraintTemplate_%d"), Index - 1), ConstraintProperties));
+
+		/* Neighbouring bodies don't collide */
+		const TSharedRef<FJsonObject> Indices = MakeShared<FJsonObject>();
+		Indices->SetArrayField(TEXT("Indices"), { MakeShared<FJsonValueNumber>(Index - 1), MakeShared<FJsonValueNumber>(Index) });
+
+		const TSharedRef<FJsonObject> Pair = MakeShared<FJsonObject>(); {
+			Pair->SetObjectField(TEXT("Key"), Indices);
+			Pair->SetBoolField(TEXT("Value"), false);
+		}
+
+		CollisionDisableTable.Add(MakeShared<FJsonValueObject>(Pair));
+	}
+
+	const TSharedRef<FJsonObject> Properties = MakeShared<FJsonObject>(); {
+		Properties->SetArrayField(TEXT("SkeletalBodySetups"), File.References(Bodies));
+		Properties->SetArrayField(TEXT("ConstraintSetup"), File.References(Constraints));
+		Properties->SetArrayField(TEXT("CollisionDisableTable"), CollisionDisableTable);
+	}
+
+	const TSharedRef<FJsonObject> Export = MakeShared<FJsonObject>();
+	Export->SetObjectField(TEXT("Properties"), Properties);
+
+	File.SetAsset(TEXT("PhysicsAsset"), Export);
+
+	return Bodies.Num();
+}
+
+/* Static mesh components with painted vertex colors, stored as subobjects of an empty PrimaryAssetLabel */
+static int32 GenerateStaticMeshComponent(FSyntheticFile& File, FRandomStream& Random, const int32 Count, const TArray<FSyntheticExport>&) {
+	constexpr int32 NumComponents = 4;
+	constexpr int32 NumLODs = 3;
+
+	int32 NumVertices = 0;
+
+	for (int32 ComponentIndex = 0; ComponentIndex < NumComponents; ComponentIndex++) {
+		TArray<TSharedPtr<FJsonValue>> LODData;
+
+		for (int32 LODIndex = 0; LODIndex < NumLODs; LODIndex++) {
+			/* Each LOD has half the vertices of the one before it */
+			const int32 NumLODVertices = FMath::Max(Count >> LODIndex, 1);
+
+			TArray<TSharedPtr<FJsonValue>> Data;
+			Data.Reserve(NumLODVertices);
+
+			for (int32 VertexIndex = 0; VertexIndex < NumLODVertices; VertexIndex++) {
+				Data.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("%08X"), Random.GetUnsignedInt())));
+			}
+
+			const TSharedRef<FJsonObject> OverrideVertexColors = MakeShared<FJsonObject>(); {
+				OverrideVertexColors->SetNumberField(TEXT("Stride"), 4);
+				OverrideVertexColors->SetNumberField(TEXT("NumVertices"), NumLODVertices);
+				OverrideVertexColors->SetArrayField(TEXT("Data"), Data);
+			}
+
+			const TSharedRef<FJsonObject> LODInfo = MakeShared<FJsonObject>();
+			LODInfo->SetObjectField(TEXT("OverrideVertexColors"), OverrideVertexColors);
+
+			LODData.Add(MakeShared<FJsonValueObject>(LODInfo));
+			NumVertices += NumLODVertices;
+		}
+
+		const TSharedRef<FJsonObject> Properties = MakeShared<FJsonObject>();
+		Properties->SetArrayField(TEXT("LODData"), LODData);
+
+		File.AddExport(TEXT("StaticMeshComponent"), FString::Printf(TEXT("StaticMeshComponent_%d"), ComponentIndex), Properties);
+	}
+
+	const TSharedRef<FJsonObject> Export = MakeShared<FJsonObject>();
+	Export->SetObjectField(TEXT("Properties"), MakeShared<FJsonObject>());
+
+	File.SetAsset(TEXT("PrimaryAssetLabel"), Export);
+
+	return NumVertices;
+}
+
+/* A PrimaryAssetLabel referencing every asset generated before it */
+static int32 GenerateDataAsset(FSyntheticFile& File, FRandomStream& Random, int32, const TArray<FSyntheticExport>& Generated) {
+	TArray<TSharedPtr<FJsonValue>> ExplicitAssets;
+
+	for (const FSyntheticExport& Export : Generated) {
+		const TSharedRef<FJsonObject> SoftPath = MakeShared<FJsonObject>(); {
+			SoftPath->SetStringField(TEXT("AssetPathName"), Export.ObjectPath);
+			SoftPath->SetStringField(TEXT("SubPathString"), TEXT(""));
+		}
+
+		ExplicitAssets.Add(MakeShared<FJsonValueObject>(SoftPath));
+	}
+
+	const TSharedRef<FJsonObject> Rules = MakeShared<FJsonObject>(); {
+		Rules->SetNumberField(TEXT("Priority"), Random.RandRange(0, 100));
+		Rules->SetBoolField(TEXT("bApplyRecursively"), false);
+	}
+
+	const TSharedRef<FJsonObject> Properties = MakeShared<FJsonObject>(); {
+		Properties->SetObjectField(TEXT("Rules"), Rules);
+		Properties->SetBoolField(TEXT("bLabelAssetsInMyDirectory"), false);
+		Properties->SetArrayField(TEXT("ExplicitAssets"), ExplicitAssets);
+	}
+
+	const TSharedRef<FJsonObject> Export = MakeShared<FJsonObject>();
+	Export->SetObjectField(TEXT("Properties"), Properties);
+
+	File.SetAsset(TEXT("PrimaryAssetLabel"), Export);
+
+	return ExplicitAssets.Num();
+}
+
+/* In generation order, data assets reference everything before them */
+static const FSyntheticType GSyntheticTypes[] = {
+	{ TEXT("DataTable"), TEXT("Tables"), TEXT("DT_Benchmark"), 2000, &GenerateDataTable },
+	{ TEXT("CurveTable"), TEXT("Tables"), TEXT("CT_Benchmark"), 2000, &GenerateCurveTable },
+	{ TEXT("UserDefinedStruct"), TEXT("Structs"), TEXT("S_Benchmark"), 300, &GenerateUserDefinedStruct },
+	{ TEXT("Material"), TEXT("Materials"), TEXT("M_Benchmark"), 5000, &GenerateMaterial },
+	{ TEXT("SoundCue"), TEXT("Audio"), TEXT("SC_Benchmark"), 256, &GenerateSoundCue },
+	{ TEXT("Skeleton"), TEXT("Animation"), TEXT("SK_Benchmark"), 128, &GenerateSkeleton },
+	{ TEXT("PoseAsset"), TEXT("Animation"), TEXT("PA_Pose_Benchmark"), 256, &GeneratePoseAsset },
+	{ TEXT("PhysicsAsset"), TEXT("Physics"), TEXT("PA_Benchmark"), 64, &GeneratePhysicsAsset },
+	{ TEXT("StaticMeshComponent"), TEXT("Components"), TEXT("SMC_Benchmark"), 20000, &GenerateStaticMeshComponent },
+	{ TEXT("DataAsset"), TEXT("Data"), TEXT("DA_Benchmark"), 0, &GenerateDataAsset }
+};
+
+TArray<FSyntheticExport> FSyntheticExportGenerator::Generate(const FString& Root, const FOptions& Options) {
+	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
+
+	/* Matches how CreateAssetPackage maps export folders to /Game */
+	const FString GameFolder = Settings->AssetSettings.GameName.IsEmpty() ? TEXT("Benchmark") : Settings->AssetSettings.GameName;
+
+	TArray<FSyntheticExport> Generated;
+
+	for (const FSyntheticType& Type : GSyntheticTypes) {
+		if (Options.Types.Num() > 0 && !Options.Types.Contains(Type.Type)) continue;
+
+		const int32 Count = FMath::Max(FMath::RoundToInt(Type.BaseCount * Options.Scale), 1);
+
+		/* Seeded per type, so selecting fewer types doesn't change the others */
+		FRandomStream Random(Options.Seed * 7919 + GetTypeHash(FString(Type.Type)));
+
+		TArray<FSyntheticExport> GeneratedOfType;
+
+		for (int32 AssetIndex = 0; AssetIndex < Options.AssetsPerType; AssetIndex++) {
+			const FString ContentPath = FString(TEXT("JsonAsAssetBenchmark")) / Type.Folder;
+
+			FSyntheticFile File; {
+				File.AssetName = FString::Printf(TEXT("%s_%d"), Type.Prefix, AssetIndex);
+				File.PackagePath = GameFolder / TEXT("Content") / ContentPath / File.AssetName;
+			}
+
+			FSyntheticExport Export; {
+				Export.Type = Type.Type;
+				Export.File = Root / File.PackagePath + TEXT(".json");
+				Export.ObjectPath = FString::Printf(TEXT("/Game/%s/%s.%s"), *ContentPath, *File.AssetName, *File.AssetName);
+				Export.ExpectedElements = Type.Generate(File, Random, Count, Generated);
+			}
+
+			FString Content;
+			const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
+			FJsonSerializer::Serialize(File.Exports, Writer);
+
+			FFileHelper::SaveStringToFile(Content, *Export.File);
+
+			GeneratedOfType.Add(Export);
+		}
+
+		Generated.Append(GeneratedOfType);
+	}
+
+	return Generated;
+}
+
+const TArray<FString>& FSyntheticExportGenerator::GetSupportedTypes() {
+	static TArray<FString> Types; {
+		if (Types.Num() == 0) {
+			for (const FSyntheticType& Type : GSyntheticTypes) {
+				Types.Add(Type.Type);
+			}
+		}
+	}
+
+	return Types;
+}
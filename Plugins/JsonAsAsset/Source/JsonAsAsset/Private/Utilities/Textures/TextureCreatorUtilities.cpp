@@ -10,6 +10,8 @@
 #include "nvimage/DirectDrawSurface.h"
 #include "nvimage/Image.h"
 #include "Utilities/EngineUtilities.h"
+#include "Utilities/ImportTrace.h"
+#include "Utilities/ImportArena.h"
 #include "Utilities/JsonUtilities.h"
 #include "Utilities/Textures/TextureDecode/TextureNVTT.h"
 
@@ -76,7 +78,8 @@ bool FTextureCreatorUtilities::CreateTextureCube(UTexture*& OutTextureCube, cons
 
 	int Size = SizeX * SizeY * (PlatformData->PixelFormat == PF_BC6H ? 16 : 4);
 	if (PlatformData->PixelFormat == PF_FloatRGBA) Size = Data.Num();
-	uint8* DecompressedData = static_cast<uint8*>(FMemory::Malloc(Size));
+	/* Scratch buffer, released with the import session */
+	uint8* DecompressedData = FImportArena::AllocArray<uint8>(Size);
 
 	ETextureSourceFormat Format = TSF_BGRA8;
 	if (TextureCube->CompressionSettings == TC_HDR) Format = TSF_RGBA16F;
@@ -245,7 +248,8 @@ bool FTextureCreatorUtilities::DeserializeTexturePlatformData(UTexture* Texture,
 
 	int Size = SizeX * SizeY * (TexturePlatformData.PixelFormat == PF_BC6H ? 16 : 4);
 	if (TexturePlatformData.PixelFormat == PF_B8G8R8A8 || TexturePlatformData.PixelFormat == PF_FloatRGBA || TexturePlatformData.PixelFormat == PF_G16) Size = Data.Num();
-	uint8* DecompressedData = static_cast<uint8*>(FMemory::Malloc(Size));
+	/* Scratch buffer, released with the import session */
+	uint8* DecompressedData = FImportArena::AllocArray<uint8>(Size);
 
 	GetDecompressedTextureData(Data.GetData(), DecompressedData, SizeX, SizeY, SizeZ, Size, TexturePlatformData.PixelFormat);
 
@@ -271,6 +275,8 @@ bool FTextureCreatorUtilities::DeserializeTexturePlatformData(UTexture* Texture,
 }
 
 void FTextureCreatorUtilities::GetDecompressedTextureData(uint8* Data, uint8*& OutData, const int SizeX, const int SizeY, const int SizeZ, const int TotalSize, const EPixelFormat Format) {
+	JSONASASSET_TRACE_SCOPE("GetDecompressedTextureData", DecompressTextures)
+
 	/* NOTE: Not all formats are supported, feel free to add if needed. Formats may need other dependencies. */
 	switch (Format) {
 		case PF_BC7: {
@@ -0,0 +1,126 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#include "Utilities/TypeResolver.h"
+
+#include "Modules/ModuleManager.h"
+#include "Styling/SlateIconFinder.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace {
+	struct FResolvedClass {
+		TWeakObjectPtr<UClass> Class;
+
+		/* False when the lookup failed, misses are cached too */
+		bool bFound = false;
+	};
+
+	TMap<FString, FResolvedClass> GResolvedClasses;
+	TMap<FString, const FSlateBrush*> GResolvedIcons;
+
+	uint32 GResolverGeneration = 0;
+
+	/* Cached misses, so clearing them is free when there are none */
+	int32 GNumResolvedMisses = 0;
+
+	FDelegateHandle GModulesChangedHandle;
+	FDelegateHandle GReloadCompleteHandle;
+}
+
+UClass* FTypeResolver::FindClass(const FString& Name) {
+	return ResolveClass(Name, [&Name]() -> UClass* {
+#if UE5_6_BEYOND
+		return FindFirstObject<UClass>(*Name);
+#else
+		return FindObject<UClass>(ANY_PACKAGE, *Name);
+#endif
+	});
+}
+
+UClass* FTypeResolver::FindClassByPath(const FString& Path) {
+	return ResolveClass(Path, [&Path]() -> UClass* {
+		return FindObject<UClass>(nullptr, *Path);
+	});
+}
+
+UClass* FTypeResolver::ResolveClass(const FString& Key, const TFunctionRef<UClass*()> Resolver) {
+	if (const FResolvedClass* Resolved = GResolvedClasses.Find(Key)) {
+		if (!Resolved->bFound) {
+			return nullptr;
+		}
+
+		/* The class may have been garbage collected since, resolve it again */
+		if (UClass* Class = Resolved->Class.Get()) {
+			return Class;
+		}
+	}
+
+	UClass* Class = Resolver();
+
+	FResolvedClass& Resolved = GResolvedClasses.FindOrAdd(Key); {
+		Resolved.Class = Class;
+		Resolved.bFound = Class != nullptr;
+	}
+
+	if (Class == nullptr) {
+		GNumResolvedMisses++;
+	}
+
+	return Class;
+}
+
+const FSlateBrush* FTypeResolver::FindIcon(const FString& Type) {
+	if (const FSlateBrush* const* Icon = GResolvedIcons.Find(Type)) {
+		return *Icon;
+	}
+
+	const FSlateBrush* Icon = FSlateIconFinder::FindCustomIconBrushForClass(FindClassByPath("/Script/Engine." + Type), TEXT("ClassThumbnail"));
+	GResolvedIcons.Add(Type, Icon);
+
+	return Icon;
+}
+
+void FTypeResolver::Invalidate() {
+	GResolvedClasses.Reset();
+	GResolvedIcons.Reset();
+	GNumResolvedMisses = 0;
+
+	GResolverGeneration++;
+}
+
+void FTypeResolver::InvalidateMisses() {
+	if (GNumResolvedMisses == 0) return;
+
+	for (auto It = GResolvedClasses.CreateIterator(); It; ++It) {
+		if (!It.Value().bFound) {
+			It.RemoveCurrent();
+		}
+	}
+
+	GNumResolvedMisses = 0;
+}
+
+uint32 FTypeResolver::GetGeneration() {
+	return GResolverGeneration;
+}
+
+void FTypeResolver::Initialize() {
+	GModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddLambda([](FName, EModuleChangeReason) {
+		Invalidate();
+	});
+
+#if ENGINE_UE5
+	GReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason) {
+		Invalidate();
+	});
+#endif
+}
+
+void FTypeResolver::Shutdown() {
+	FModuleManager::Get().OnModulesChanged().Remove(GModulesChangedHandle);
+
+#if ENGINE_UE5
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(GReloadCompleteHandle);
+#endif
+
+	Invalidate();
+}
@@ -0,0 +1,56 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "BenchmarkCommandlet.generated.h"
+
+struct FSyntheticExport;
+
+/*
+ * Generates synthetic exports (see FSyntheticExportGenerator), imports them headlessly,
+ * checks the resulting assets and records timings and memory per type.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd.exe Project.uproject -run=JsonAsAssetBenchmark
+ *     [-Seed=1] [-Scale=1.0] [-Count=2]
+ *     [-Types="DataTable+Material"]
+ *     [-Label="Baseline"]
+ *     [-Baseline="Saved/JsonAsAsset/Benchmark/Results_Baseline.json"]
+ *     [-Threshold=0.15]
+ *     [-GenerateOnly]
+ *
+ * Results are written to Saved/JsonAsAsset/Benchmark/Results_<Label>.json. Passing the
+ * results of another commit as -Baseline compares every type against it, the commandlet
+ * fails when an asset doesn't verify or a type got slower than the threshold allows.
+ */
+UCLASS()
+class JSONASASSET_API UJsonAsAssetBenchmarkCommandlet : public UCommandlet {
+	GENERATED_BODY()
+public:
+	UJsonAsAssetBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+protected:
+	struct FTypeResult {
+		int32 Assets = 0;
+		int32 Verified = 0;
+		int32 Elements = 0;
+
+		double Seconds = 0.0;
+
+		/* Peak and retained memory while importing this type, in bytes */
+		uint64 PeakMemory = 0;
+		uint64 RetainedMemory = 0;
+
+		TMap<FString, double> Phases;
+		TArray<FString> Failures;
+	};
+
+	/* Loads the imported asset and counts its elements, empty when it matches the export */
+	static FString VerifyAsset(const FSyntheticExport& Export, int32& OutElements);
+
+	/* Returns how many types regressed */
+	static int32 CompareWithBaseline(const FString& BaselinePath, const TMap<FString, FTypeResult>& Results, double Threshold);
+};
@@ -0,0 +1,70 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "BulkImportCommandlet.generated.h"
+
+/*
+ * Imports a whole CUE4Parse export tree without the editor UI.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd.exe Project.uproject -run=JsonAsAssetBulkImport -Root="C:/FModel/Output/Exports"
+ *     [-Include="Game/Content/Characters/*+Game/Content/Weapons/*"]
+ *     [-Exclude="*_Legacy*"]
+ *     [-Manifest="Saved/JsonAsAsset/BulkImportManifest.json"]
+ *     [-Fresh]
+ *     [-DryRun]
+ *
+ * Every file is parsed (in parallel) to collect the packages it references, files are then
+ * imported in dependency order so referenced assets exist before the assets that use them.
+ * Progress is written to a manifest, re-running the same command continues where it stopped.
+ *
+ * -DryRun only writes a preflight report (see FImportPreflight) of the selected files.
+ */
+UCLASS()
+class JSONASASSET_API UJsonAsAssetBulkImportCommandlet : public UCommandlet {
+	GENERATED_BODY()
+public:
+	UJsonAsAssetBulkImportCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+protected:
+	struct FBulkImportFile {
+		/* Path relative to the export root, used as the manifest key */
+		FString RelativePath;
+		FString FullPath;
+
+		/* Normalized package key of this file, and the package keys it references */
+		FString PackageKey;
+		TArray<FString> References;
+
+		bool bParsed = false;
+	};
+
+	/* Collects every json file under the root that passes the include/exclude filters */
+	void GatherFiles(const FString& Root, const TArray<FString>& Includes, const TArray<FString>& Excludes, TArray<FBulkImportFile>& OutFiles) const;
+
+	/* Parses all files using every core, filling in their package references */
+	static void ParseReferences(TArray<FBulkImportFile>& Files);
+
+	/* Kahn's algorithm, files in a reference cycle are appended in their original order */
+	static TArray<int32> SortByDependencies(const TArray<FBulkImportFile>& Files);
+
+	/* Imports a single file and saves the packages it created */
+	static bool ImportFile(const FBulkImportFile& File);
+
+	/* Saves every dirty content package, regardless of the bSavePackagesOnImport setting */
+	static void SaveDirtyPackages();
+
+	/* Manifest ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+	void LoadManifest();
+	void SaveManifest() const;
+
+	FString ManifestPath;
+	FString RootPath;
+
+	TSet<FString> CompletedFiles;
+	TSet<FString> FailedFiles;
+};
@@ -38,6 +38,9 @@ protected:
 	UMaterialExpression* OnMissingNodeClass(FUObjectExport& Export, FUObjectExportContainer& Container);
 	void SpawnMaterialDataMissingNotification() const;
 
+	/* Expression classes of this graph by type name, misses included */
+	TMap<FName, const UClass*> ExpressionClasses;
+
 #if ENGINE_UE4
 	/*
 	 * In Unreal Engine 4, to combat the absence of Sub-graphs, create a Material Function in place of it
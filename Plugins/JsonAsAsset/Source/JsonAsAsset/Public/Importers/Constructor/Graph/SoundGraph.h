@@ -16,15 +16,17 @@ public:
 		IImporter(AssetName, FilePath, JsonObject, Package, OutermostPkg, AllJsonObjects, AssetClass) {
 	}
 
-	/* Graph Functions */
-	static void ConnectEdGraphNode(UEdGraphNode* NodeToConnect, UEdGraphNode* NodeToConnectTo, int Pin);
-	static void ConnectSoundNode(const USoundNode* NodeToConnect, const USoundNode* NodeToConnectTo, int Pin);
-
-	/* Creates an empty USoundNode */
+	/* Creates an empty USoundNode, named after its export */
 	static USoundNode* CreateEmptyNode(FName Name, FName Type, USoundCue* SoundCue);
 
-	static void ConstructNodes(USoundCue* SoundCue, TArray<TSharedPtr<FJsonValue>> JsonArray, TMap<FString, USoundNode*>& OutNodes);
-	void SetupNodes(USoundCue* SoundCueAsset, TMap<FString, USoundNode*> SoundCueNodes, TArray<TSharedPtr<FJsonValue>> JsonObjectArray) const;
+	/* Creates the runtime sound node of every export, without touching the editor graph */
+	static void ConstructNodes(USoundCue* SoundCue, const TArray<TSharedPtr<FJsonValue>>& JsonArray, FUObjectExportContainer& OutNodes);
+
+	/* Resolves the first node, every node's children and their properties in one pass */
+	void SetupNodes(USoundCue* SoundCue, FUObjectExportContainer& SoundCueNodes) const;
+
+	/* Generates the editor graph once from the finished node tree */
+	static void CreateGraphFromNodes(USoundCue* SoundCue);
 
 	/* Sound Wave Import */
 	void ImportSoundWave(const FString& URL, FString SavePath, FString AssetPtr, USoundNodeWavePlayer* Node) const;
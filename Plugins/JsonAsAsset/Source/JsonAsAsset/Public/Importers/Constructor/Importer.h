@@ -4,11 +4,13 @@
 
 #include "Utilities/Compatibility.h"
 #include "Utilities/EngineUtilities.h"
+#include "Utilities/ImportArena.h"
 #include "Utilities/JsonUtilities.h"
 #include "Dom/JsonObject.h"
 #include "CoreMinimal.h"
 #include "Styling/SlateIconFinder.h"
 #include "Utilities/Serializers/SerializerContainer.h"
+#include "Utilities/TypeResolver.h"
 
 /* AssetType/Category ~ Defined in CPP */
 extern TMap<FString, TArray<FString>> ImporterTemplatedTypes;
@@ -48,8 +50,12 @@ namespace { \
     static FAutoRegister_##ImporterClass AutoRegister_##ImporterClass; \
 }
 
+class FExportsImport;
+
 /* Global handler for converting JSON to assets */
 class JSONASASSET_API IImporter : public USerializerContainer {
+    friend class FExportsImport;
+
 public:
     /* Constructors ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
     IImporter() : AssetClass(nullptr), ParentObject(nullptr) {}
@@ -92,17 +98,36 @@ public:
     static FImporterFactoryDelegate* FindFactoryForAssetType(const FString& AssetType) {
         const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
 
-        for (auto& Pair : GetFactoryRegistry()) {
-            if (!Settings->bEnableExperiments) {
-                if (ExperimentalAssetTypes.Contains(AssetType)) return nullptr;
-            }
-            
-            if (Pair.Key.Contains(AssetType)) {
-                return &Pair.Value.Factory;
+        if (!Settings->bEnableExperiments && ExperimentalAssetTypes.Contains(AssetType)) {
+            return nullptr;
+        }
+
+        /* Type -> Factory, rebuilt whenever the registry grows or the type resolver is invalidated */
+        static TMap<FString, FImporterFactoryDelegate*> FactoriesByType;
+        static int32 CachedRegistryNum = INDEX_NONE;
+        static uint32 CachedGeneration = 0;
+
+        TMap<TArray<FString>, FImporterRegistrationInfo>& Registry = GetFactoryRegistry();
+
+        if (CachedRegistryNum != Registry.Num() || CachedGeneration != FTypeResolver::GetGeneration()) {
+            FactoriesByType.Reset();
+
+            for (auto& Pair : Registry) {
+                for (const FString& Type : Pair.Key) {
+                    /* The first registered importer for a type wins */
+                    if (!FactoriesByType.Contains(Type)) {
+                        FactoriesByType.Add(Type, &Pair.Value.Factory);
+                    }
+                }
             }
+
+            CachedRegistryNum = Registry.Num();
+            CachedGeneration = FTypeResolver::GetGeneration();
         }
+
+        FImporterFactoryDelegate* const* Factory = FactoriesByType.Find(AssetType);
         
-        return nullptr;
+        return Factory ? *Factory : nullptr;
     }
 
 public:
@@ -179,11 +204,7 @@ public:
         if (CanImportWithCloud(ImporterType))
 
         if (!Class) {
-#if UE5_6_BEYOND
-            Class = FindFirstObject<UClass>(*ImporterType);
-#else
-        	Class = FindObject<UClass>(ANY_PACKAGE, *ImporterType);
-#endif
+            Class = FTypeResolver::FindClass(ImporterType);
         }
 
         if (Class == nullptr) return false;
@@ -217,22 +238,34 @@ public:
     /* Sends off to the ReadExportsAndImport function once read */
     static void ImportReference(const FString& File);
 
+    /* Reads a file for importing an export at a time, nullptr (and a failed report entry) if it can't be parsed */
+    static TUniquePtr<FExportsImport> BeginImportReference(const FString& File);
+
     /*
      * Searches for importable asset types and imports them.
      */
     static bool ReadExportsAndImport(TArray<TSharedPtr<FJsonValue>> Exports, FString File, bool bHideNotifications = false);
 
+    /* Saves a package if the user chose to save packages on import */
+    static void SavePackage(UPackage* InPackage);
+
 public:
     TArray<TSharedPtr<FJsonValue>> GetObjectsWithPropertyNameStartingWith(const FString& StartsWithStr, const FString& PropertyName);
     TArray<TSharedPtr<FJsonValue>> FilterObjectsWithoutMatchingPropertyName(const FString& StartsWithStr, const FString& PropertyName);
 
     UObject* ParentObject;
+
+    /* True after a delta reimport that didn't change anything, the asset mustn't be saved */
+    FORCEINLINE bool IsAssetUnchanged() const { return bAssetUnchanged; }
     
 protected:
     /* This is called at the end of asset creation, bringing the user to the asset and fully loading it */
     bool HandleAssetCreation(UObject* Asset) const;
     void SavePackage() const;
 
+    /* Drops the json held by this importer and its serializers, called once the asset is imported */
+    void ReleaseJsonData();
+
     TMap<FName, FExportData> CreateExports();
 
     /*
@@ -240,6 +273,22 @@ protected:
      */
     bool OnAssetCreation(UObject* Asset) const;
 
+    /* Returns the existing asset of the given class if it should be reimported using property deltas */
+    UObject* FindAssetForDeltaReimport(const UClass* Class) const;
+
+    /*
+     * True if the exports are the same ones the asset was last imported from, for delta reimports
+     * of assets that are rebuilt instead of patched property by property (e.g. materials).
+     */
+    bool IsUnchangedSinceLastImport() const;
+
+    /* Hash of the file's exports (see FImportHashCache), empty unless unchanged imports are skipped or reimports are deltas */
+    FString ExportsHash;
+
+    /* Finishes a delta reimport, an unchanged asset is left untouched (not dirtied, edited or saved) */
+    bool OnAssetReimport(UObject* Asset, bool bChanged) const;
+    mutable bool bAssetUnchanged = false;
+
     virtual void ApplyModifications() {};
     static FName GetExportNameOfSubobject(const FString& PackageIndex);
     TArray<TSharedPtr<FJsonValue>> FilterExportsByOuter(const FString& Outer);
@@ -268,7 +317,7 @@ public:
                 /* Try importing the asset */
                 if (FAssetUtilities::ConstructAsset(FSoftObjectPath(Type + "'" + Path + "." + Name + "'").ToString(), Type, InObject, bDownloadStatus)) {
                     const FText AssetNameText = FText::FromString(Name);
-                    const FSlateBrush* IconBrush = FSlateIconFinder::FindCustomIconBrushForClass(FindObject<UClass>(nullptr, *("/Script/Engine." + Type)), TEXT("ClassThumbnail"));
+                    const FSlateBrush* IconBrush = FTypeResolver::FindIcon(Type);
 
                     if (bDownloadStatus) {
                         AppendNotification(
@@ -305,4 +354,57 @@ public:
 protected:
     void DeserializeExports(UObject* Parent);
     /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Object Serializer and Property Serializer ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+};
+
+/*
+ * The exports of one file, imported one at a time.
+ *
+ * ReadExportsAndImport runs it to the end in one go, the import queue (see FImportQueue)
+ * imports an export per step so a large file is spread over several frames. Every step
+ * imports (and saves) a whole asset, stopping between steps never leaves one half written.
+ */
+class JSONASASSET_API FExportsImport {
+public:
+    FExportsImport(TArray<TSharedPtr<FJsonValue>> InExports, const FString& InFile, bool bInHideNotifications = false);
+
+    /* Imports the next export, returns false once the file is done */
+    bool ImportNext();
+
+    /* False if the file stopped at an export it couldn't import */
+    bool WasSuccessful() const { return bSuccessful; }
+
+private:
+    void ImportExport(int32 ExportIndex);
+
+    /* Stops the file, no other export is imported */
+    void Stop(const bool bInSuccessful) {
+        bSuccessful = bInSuccessful;
+        bDone = true;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> Exports;
+    FString File;
+    bool bHideNotifications;
+
+    /* Transient buffers are released once the outermost import finishes */
+    FImportArena::FScope ArenaScope;
+
+    /* With a memory budget, imported in windows ordered by outer, so a window can be released once its asset exists */
+    TArray<TArray<int32>> Windows;
+    TArray<int32> WindowOfExport;
+    TArray<int32> ImportOrder;
+    int32 NextExport = 0;
+
+    /* The exports importers are given, released windows are left out */
+    TArray<TSharedPtr<FJsonValue>> LiveExports;
+    bool bReleasedWindow = false;
+
+    /* Hash of the exports, only computed once an export is about to be imported */
+    FString ExportsHash;
+
+    /* Referenced packages are loaded once per file, right before the first import */
+    bool bPrefetchedReferences = false;
+
+    bool bDone = false;
+    bool bSuccessful = true;
 };
\ No newline at end of file
@@ -13,8 +13,10 @@ public:
 	UPoseAsset* PoseAsset;
 
 	virtual bool Import() override;
-	void ReverseCookLocalSpacePose(USkeleton* Skeleton) const;
-	static UAnimSequence* CreateAnimSequenceFromPose(USkeleton* Skeleton, const FString& SequenceName, const TSharedPtr<FJsonObject>& PoseContainer, UPackage* Outer);
+
+	/* Rebuilds the source pose of every pose from its cooked LocalSpacePose, one transform per track */
+	void ReverseCookLocalSpacePose(USkeleton* Skeleton, TArray<TArray<FTransform>>& OutSourcePoses) const;
+	static UAnimSequence* CreateAnimSequenceFromPose(USkeleton* Skeleton, const FString& SequenceName, const TArray<FName>& Tracks, const TArray<TArray<FTransform>>& SourcePoses, UPackage* Outer);
 };
 
 REGISTER_IMPORTER(IPoseAssetImporter, TArray<FString>{ 
@@ -14,10 +14,16 @@ public:
 
 	void DeserializeCurveMetaData(FCurveMetaData* OutMeta, const TSharedPtr<FJsonObject>& Json) const;
 	virtual void ApplyModifications() override;
-	void ApplySkeletalChanges(USkeleton* Skeleton) const;
+
+	/* Builds the reference skeleton of a new skeleton, fails if the bone hierarchy is invalid */
+	bool ApplySkeletalChanges(USkeleton* Skeleton) const;
 	void ApplySkeletalAssetData(USkeleton* Skeleton) const;
 
 	static void RebuildSkeleton(const USkeleton* Skeleton);
+
+protected:
+	/* CurveMetaData of an AnimCurveMetaData export (UE5 data imported on UE4) */
+	TArray<TSharedPtr<FJsonValue>> UE5CurveMetaData;
 };
 
 REGISTER_IMPORTER(ISkeletonImporter, {
@@ -52,6 +52,12 @@ protected:
 	TSharedPtr<FJsonObject> RootAnimNodeProperties;
 	FUObjectExportContainer RootAnimNodeContainer;
 
+	/* (Machine, State) -> the anim node properties of that state's graph */
+	TMap<TPair<FString, FString>, TSharedPtr<FJsonObject>> StateAnimNodeProperties;
+
+	int32 NumGraphsCreated = 0;
+	int32 NumNodesCreated = 0;
+
 	/* UE5 Copy Record Cache Data */
 	TSharedPtr<FJsonObject> SerializedSparseClassData;
 
@@ -21,6 +21,15 @@ public:
 
 	static USkeletalBodySetup* CreateNewBody(UPhysicsAsset* PhysAsset, FName ExportName, FName BoneName);
 	static UPhysicsConstraintTemplate* CreateNewConstraint(UPhysicsAsset* PhysAsset, FName ExportName);
+
+protected:
+	/* A body setup or constraint template, parsed before any of them are created */
+	struct FPhysicsSubobjectExport {
+		FName ExportName;
+		TSharedPtr<FJsonObject> Properties;
+	};
+
+	static TArray<FPhysicsSubobjectExport> ParseSubobjectExports(const TSharedPtr<FJsonObject>& AssetData, const FString& FieldName, const TMap<FName, FExportData>& Exports);
 };
 
 REGISTER_IMPORTER(IPhysicsAssetImporter, {
@@ -8,6 +8,9 @@
 class CCurveTableDerived : public UCurveTable {
 public:
 	void ChangeTableMode(ECurveTableMode Mode);
+
+	/* The row map is protected, reserved before rows are added in bulk */
+	void ReserveRows(int32 Num);
 };
 
 class ICurveTableImporter : public IImporter {
@@ -9,6 +9,8 @@
 #include "Engine/UserDefinedStruct.h"
 #endif
 
+struct FStructVariableDescription;
+
 class IUserDefinedStructImporter : public IImporter {
 public:
 	IUserDefinedStructImporter(const FString& AssetName, const FString& FilePath, const TSharedPtr<FJsonObject>& JsonObject, UPackage* Package, UPackage* OutermostPkg, const TArray<TSharedPtr<FJsonValue>>& AllJsonObjects, UClass* AssetClass):
@@ -21,8 +23,17 @@ protected:
 	TSharedPtr<FJsonObject> CookedStructMetaData;
 	TSharedPtr<FJsonObject> DefaultProperties;
 
+	/* Property name -> its cooked metadata */
+	TMap<FString, TSharedPtr<FJsonObject>> PropertiesMetaData;
+
 	FEdGraphPinType ResolvePropertyPinType(const TSharedPtr<FJsonObject>& PropertyJsonObject);
-	void ImportPropertyIntoStruct(UUserDefinedStruct* UserDefinedStruct, const TSharedPtr<FJsonObject>& PropertyJsonObject);
+
+	/* Adds a variable description without compiling the struct, returns the property name */
+	FString AddPropertyDescription(UUserDefinedStruct* UserDefinedStruct, const TSharedPtr<FJsonObject>& PropertyJsonObject);
+
+	/* Deserializes a default value into the instance and stores it as text on the variable */
+	void ApplyPropertyDefaults(UUserDefinedStruct* UserDefinedStruct, FStructVariableDescription& Variable, const FString& Name, uint8* InstanceMemory) const;
+	void ApplyPropertyMetaData(UUserDefinedStruct* UserDefinedStruct, const FString& Name) const;
 	UObject* LoadObjectFromJsonReference(const TSharedPtr<FJsonObject>& ParentJsonObject, const FString& ReferenceKey);
 };
 
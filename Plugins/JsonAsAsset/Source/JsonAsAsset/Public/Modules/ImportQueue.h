@@ -0,0 +1,35 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class SNotificationItem;
+
+/*
+ * Imports a list of files over several frames instead of blocking the editor.
+ *
+ * Reading a file and importing each of its exports (see FExportsImport) are the units
+ * of work, they run back to back until the frame budget (see FAssetSettings::ImportFrameBudgetMs)
+ * is used up, then the editor gets a frame. Cancelling stops the queue after the asset
+ * currently being imported, so no package is ever left half written.
+ *
+ * The queue is one import report session (see FImportReport), the results of every
+ * asset end up in the Import Report panel instead of a notification each.
+ */
+class FImportQueue {
+public:
+	/* Queues files for import, starts the queue if it isn't running */
+	static void Enqueue(const TArray<FString>& Files);
+
+	/* Stops after the asset being imported */
+	static void Cancel();
+
+	static bool IsRunning();
+
+private:
+	static bool Tick(float DeltaTime);
+	static void Finish();
+
+	static void UpdateNotification();
+};
@@ -0,0 +1,11 @@
+﻿/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ToolBase.h"
+
+/* Dry run of importing a folder of exports, see FImportPreflight */
+struct FToolPreflightAnalysis : FToolBase {
+	static void Execute();
+};
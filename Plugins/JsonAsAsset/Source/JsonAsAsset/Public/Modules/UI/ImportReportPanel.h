@@ -0,0 +1,55 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+
+#include "Utilities/ImportReport.h"
+
+/* Dockable panel listing the report of the last import session */
+class SImportReportPanel : public SCompoundWidget {
+public:
+	SLATE_BEGIN_ARGS(SImportReportPanel) {}
+	SLATE_END_ARGS()
+
+	static const FName TabName;
+
+	/* Nomad tab, registered by the module */
+	static void RegisterTab();
+	static void UnregisterTab();
+
+	static void Open();
+
+	void Construct(const FArguments& InArgs);
+	virtual ~SImportReportPanel() override;
+
+private:
+	void Refresh();
+	void RefreshEntries();
+
+	TSharedRef<ITableRow> GenerateRow(TSharedPtr<FImportReportEntry> Entry, const TSharedRef<STableViewBase>& OwnerTable) const;
+
+	FText GetSummaryText() const;
+	FText GetDetailsText() const;
+
+	FText BuildSummaryText() const;
+	FText BuildDetailsText() const;
+
+	TSharedPtr<const FImportReportData> Report;
+
+	/* Built by Refresh, the report doesn't change until the next one replaces it */
+	FText SummaryText;
+	FText DetailsText;
+
+	/* Entries passing the status filter */
+	TArray<TSharedPtr<FImportReportEntry>> VisibleEntries;
+	TSharedPtr<SListView<TSharedPtr<FImportReportEntry>>> ListView;
+
+	bool bShowImported = true;
+	bool bShowFailed = true;
+	bool bShowSkipped = true;
+
+	FDelegateHandle ReportUpdatedHandle;
+};
@@ -101,6 +101,10 @@ public:
 	/* Constructor to initialize default values */
 	FAssetSettings()
 		: bSavePackagesOnImport(false)
+		, bSkipUnchangedImports(true)
+		, bReimportChangedPropertiesOnly(true)
+		, ImportFrameBudgetMs(100)
+		, ImportMemoryBudgetMB(0)
 	{
 		MaterialImportSettings = FJMaterialImportSettings();
 		SoundImportSettings = FJSoundImportSettings();
@@ -135,6 +139,37 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = AssetSettings, meta = (DisplayName = "Save Assets On Import"))
 	bool bSavePackagesOnImport;
 
+	/**
+	 * Skips importing an export if its json and the plugin version match the last import of the same asset.
+	 * Disable to always recreate assets.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = AssetSettings)
+	bool bSkipUnchangedImports;
+
+	/**
+	 * When importing over an existing asset, only writes the properties that differ from the asset's current values.
+	 * Assets with no differences aren't dirtied, edited or saved.
+	 *
+	 * Used by Data Tables, Data Assets and assets without a dedicated importer. Materials and material
+	 * functions are left untouched when their exports are the same as last import, otherwise rebuilt.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = AssetSettings)
+	bool bReimportChangedPropertiesOnly;
+
+	/**
+	 * How long (in milliseconds) files are imported for each editor frame when importing several files.
+	 * Higher values import faster, lower values keep the editor more responsive.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = AssetSettings, AdvancedDisplay, meta = (ClampMin = "1", UIMin = "10", UIMax = "1000"))
+	int32 ImportFrameBudgetMs;
+
+	/**
+	 * Resident memory (in megabytes) imports try to stay under, 0 for no limit.
+	 * Once exceeded, the json of imported exports is released and garbage is collected between files.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = AssetSettings, AdvancedDisplay, meta = (ClampMin = "0", UIMin = "0"))
+	int32 ImportMemoryBudgetMB;
+
 	UPROPERTY(EditAnywhere, Config, Category = AssetSettings)
 	TArray<FJPathRedirector> PathRedirectors;
 };
@@ -196,9 +196,22 @@ inline TArray<TSharedPtr<FJsonValue>> RequestExports(const FString& Path) {
 	return Exports;
 }
 
-inline TSharedPtr<FJsonObject> RequestExport(const FString& FetchPath = "/api/export?raw=true&path=", const FString& Path = "") {
+/* Responses of RequestExport, emptied once it reaches this many entries */
+static constexpr int32 GExportCacheLimit = 512;
+
+inline TMap<FString, TSharedPtr<FJsonObject>>& GetExportCache() {
 	static TMap<FString, TSharedPtr<FJsonObject>> ExportCache;
 
+	return ExportCache;
+}
+
+inline void ClearExportCache() {
+	GetExportCache().Empty();
+}
+
+inline TSharedPtr<FJsonObject> RequestExport(const FString& FetchPath = "/api/export?raw=true&path=", const FString& Path = "") {
+	TMap<FString, TSharedPtr<FJsonObject>>& ExportCache = GetExportCache();
+
 	if (Path.IsEmpty()) return TSharedPtr<FJsonObject>();
 
 	/* Check cache first */
@@ -210,6 +223,10 @@ inline TSharedPtr<FJsonObject> RequestExport(const FString& FetchPath = "/api/ex
 	TSharedPtr<FJsonObject> Response = FAssetUtilities::API_RequestExports(Path, FetchPath);
 	
 	if (Response) {
+		if (ExportCache.Num() >= GExportCacheLimit) {
+			ExportCache.Empty();
+		}
+
 		ExportCache.Add(Path, Response);
 	}
 
@@ -571,7 +588,11 @@ inline auto AppendNotification(const FText& Text, const FText& SubText, const fl
 	SetNotificationSubText(Info, SubText);
 
 	const TSharedPtr<SNotificationItem> NotificationPtr = FSlateNotificationManager::Get().AddNotification(Info);
-	NotificationPtr->SetCompletionState(CompletionState);
+
+	/* No notification is created without Slate (e.g. commandlets) */
+	if (NotificationPtr.IsValid()) {
+		NotificationPtr->SetCompletionState(CompletionState);
+	}
 }
 
 /* Show the user a Notification with Subtext */
@@ -589,7 +610,11 @@ inline auto AppendNotification(const FText& Text, const FText& SubText, float Ex
 	SetNotificationSubText(Info, SubText);
 
 	const TSharedPtr<SNotificationItem> NotificationPtr = FSlateNotificationManager::Get().AddNotification(Info);
-	NotificationPtr->SetCompletionState(CompletionState);
+
+	/* No notification is created without Slate (e.g. commandlets) */
+	if (NotificationPtr.IsValid()) {
+		NotificationPtr->SetCompletionState(CompletionState);
+	}
 }
 
 inline int32 ConvertVersionStringToInt(const FString& VersionStr) {
@@ -597,30 +622,48 @@ inline int32 ConvertVersionStringToInt(const FString& VersionStr) {
 }
 
 inline FString ReadPathFromObject(const TSharedPtr<FJsonObject>* PackageIndex) {
-	FString ObjectType, ObjectName, ObjectPath, Outer;
-	PackageIndex->Get()->GetStringField(TEXT("ObjectName")).Split("'", &ObjectType, &ObjectName);
+	const FString ObjectNameField = PackageIndex->Get()->GetStringField(TEXT("ObjectName"));
+	const FString ObjectPathField = PackageIndex->Get()->GetStringField(TEXT("ObjectPath"));
 
-	ObjectPath = PackageIndex->Get()->GetStringField(TEXT("ObjectPath"));
-	ObjectPath.Split(".", &ObjectPath, nullptr);
+	/* Parsed using views, called for every reference so only the result is allocated */
+	int32 CharIndex;
 
-	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
+	/* Type'Outer.Name' -> Outer.Name' */
+	FStringView ObjectName;
+	if (FStringView(ObjectNameField).FindChar(TEXT('\''), CharIndex)) {
+		ObjectName = FStringView(ObjectNameField).RightChop(CharIndex + 1);
+	}
 
-	if (!Settings->AssetSettings.GameName.IsEmpty()) {
-		ObjectPath = ObjectPath.Replace(*(Settings->AssetSettings.GameName + "/Content"), TEXT("/Game"));
+	/* Up to two outers are removed */
+	for (int32 Pass = 0; Pass < 2; Pass++) {
+		if (ObjectName.FindChar(TEXT('.'), CharIndex)) {
+			ObjectName.RightChopInline(CharIndex + 1);
+		}
 	}
 
-	ObjectPath = ObjectPath.Replace(TEXT("Engine/Content"), TEXT("/Engine"));
-	ObjectName = ObjectName.Replace(TEXT("'"), TEXT(""));
+	/* Package.Name -> Package */
+	FStringView ObjectPath = ObjectPathField;
+	if (ObjectPath.FindChar(TEXT('.'), CharIndex)) {
+		ObjectPath.LeftInline(CharIndex);
+	}
 
-	if (ObjectName.Contains(".")) {
-		ObjectName.Split(".", nullptr, &ObjectName);
+	FString Result(ObjectPath);
+	Result.Reserve(ObjectPath.Len() + ObjectName.Len() + 1);
+
+	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
+
+	if (!Settings->AssetSettings.GameName.IsEmpty()) {
+		Result.ReplaceInline(*(Settings->AssetSettings.GameName + "/Content"), TEXT("/Game"));
 	}
 
-	if (ObjectName.Contains(".")) {
-		ObjectName.Split(".", &Outer, &ObjectName);
+	Result.ReplaceInline(TEXT("Engine/Content"), TEXT("/Engine"));
+	Result.AppendChar(TEXT('.'));
+
+	for (const TCHAR Character : ObjectName) {
+		if (Character != TEXT('\'')) Result.AppendChar(Character);
 	}
 
-	return ObjectPath + "." + ObjectName;
+	return Result;
 }
 
 /* Creates a plugin in the name (may result in bugs if inputted wrong) */
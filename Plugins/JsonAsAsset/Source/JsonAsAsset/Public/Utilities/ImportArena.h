@@ -0,0 +1,32 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/*
+ * Linear allocator for transient buffers of an import session (e.g. decompressed texture data).
+ *
+ * Allocations are never freed one by one, everything is released in one go when the
+ * outermost session scope ends. Allocations made outside a session are kept until the
+ * next session ends.
+ *
+ * Game thread only.
+ */
+class JSONASASSET_API FImportArena {
+public:
+	/* Opens an import session, nested scopes belong to the outermost one */
+	struct JSONASASSET_API FScope {
+		FScope();
+		~FScope();
+	};
+
+	static void* Alloc(SIZE_T Size, uint32 Alignment = DEFAULT_ALIGNMENT);
+
+	template <typename T>
+	static T* AllocArray(const int32 Num) {
+		return static_cast<T*>(Alloc(sizeof(T) * Num, alignof(T)));
+	}
+
+	static bool IsSessionActive();
+};
@@ -0,0 +1,44 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+
+/*
+ * Remembers the content hash of the json each asset was last imported from,
+ * so importing the same unchanged export again can be skipped.
+ *
+ * Stored as a sidecar file in Saved/JsonAsAsset, one line per import: PackageName, Hash, Plugin Version.
+ * Lines are only ever appended, later lines override earlier ones when loaded.
+ */
+class JSONASASSET_API FImportHashCache {
+public:
+	/* Hashes the exports of a file and the import settings, the order of the exports is part of the hash */
+	static FString ComputeHash(const TArray<TSharedPtr<FJsonValue>>& Exports);
+
+	/* True if the package was last imported from the same hash with the current plugin version */
+	static bool IsUpToDate(const FString& PackageName, const FString& Hash);
+
+	/* Records a successful import */
+	static void Record(const FString& PackageName, const FString& Hash);
+
+	/* Forgets a package, so the next import always runs */
+	static void Invalidate(const FString& PackageName);
+
+	/* Binds invalidation to assets being deleted or renamed */
+	static void Initialize();
+	static void Shutdown();
+
+protected:
+	struct FEntry {
+		FString Hash;
+		FString Version;
+	};
+
+	static TMap<FString, FEntry>& GetEntries();
+	static FString GetCachePath();
+	static const FString& GetPluginVersion();
+	static FString GetSettingsFingerprint();
+	static void AppendLine(const FString& PackageName, const FEntry& Entry);
+};
@@ -0,0 +1,33 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/*
+ * Keeps resident memory of large imports within FAssetSettings::ImportMemoryBudgetMB.
+ *
+ * Memory is sampled while importing to track the peak of the session. Once the budget
+ * is exceeded, the json of exports that have been imported is released, the Cloud export
+ * cache is emptied and garbage is collected between files so saved packages can unload.
+ *
+ * Only packages saved to disk (and not modified since) are unloaded, they can be loaded again.
+ */
+class JSONASASSET_API FImportMemory {
+public:
+	/* Resident memory of the editor process, in bytes */
+	static uint64 GetUsedMemory();
+
+	/* Samples the used memory, returns true if it exceeds the budget (never without a budget) */
+	static bool IsOverBudget();
+
+	/* Frees what can be freed between two files, only when over budget */
+	static void TrimBetweenFiles();
+
+	/* Unroots the assets of a package that was just saved, so trimming can unload it */
+	static void ReleaseSavedPackage(UPackage* Package);
+
+	/* Peak resident memory since the last reset, in bytes */
+	static uint64 GetPeakMemory();
+	static void ResetPeakMemory();
+};
@@ -0,0 +1,66 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/* Result of a dry run over a set of export files */
+struct JSONASASSET_API FImportPreflightReport {
+	int32 Files = 0;
+	int32 UnreadableFiles = 0;
+
+	int32 Exports = 0;
+	int32 ImportableExports = 0;
+
+	/* Files without a single export the importer accepts */
+	int32 SkippedFiles = 0;
+
+	/* Export count of every type */
+	TMap<FString, int32> TypeCounts;
+
+	/* Types IImporter::CanImport rejects, and types without a class in this project */
+	TMap<FString, int32> UnsupportedTypes;
+	TMap<FString, int32> MissingClasses;
+
+	/* Unique packages referenced, and how they'll be resolved */
+	int32 References = 0;
+	int32 ReferencesInFiles = 0;
+	int32 ReferencesInProject = 0;
+	int32 MissingReferences = 0;
+	int32 RemoteDownloads = 0;
+
+	/* Longest chain of files referencing each other, files in reference cycles aren't included */
+	int32 DependencyDepth = 0;
+	int32 FilesInCycles = 0;
+
+	/* Rough estimate of the import time in seconds */
+	double EstimatedSeconds = 0.0;
+
+	/* How long the analysis itself took */
+	double ScanSeconds = 0.0;
+
+	TSharedRef<FJsonObject> ToJson() const;
+	FString ToString() const;
+};
+
+/*
+ * Dry run of an import, nothing is loaded or created.
+ *
+ * Files are scanned in parallel with a streaming json reader that only keeps the Type,
+ * Name and Outer of each export and the object paths it references, so tens of thousands
+ * of files are analyzed in seconds.
+ */
+class JSONASASSET_API FImportPreflight {
+public:
+	static FImportPreflightReport Analyze(const TArray<FString>& Files);
+
+	/* Analyzes every json file in a directory */
+	static FImportPreflightReport AnalyzeDirectory(const FString& Directory);
+
+	/* Writes the report to Saved/JsonAsAsset/PreflightReport.json, returns the path */
+	static FString SaveReport(const FImportPreflightReport& Report);
+
+	/* Converts a file path or an ObjectPath into a comparable package key */
+	static FString ToPackageKey(const FString& Path);
+};
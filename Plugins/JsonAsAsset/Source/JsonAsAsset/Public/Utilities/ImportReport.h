@@ -0,0 +1,119 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+enum class EImportReportStatus : uint8 {
+	Imported,
+	Failed,
+
+	/* Unchanged since the last import */
+	Skipped
+};
+
+struct JSONASASSET_API FImportReportEntry {
+	FString Name;
+	FString Type;
+	FString Package;
+	FString File;
+
+	EImportReportStatus Status = EImportReportStatus::Imported;
+
+	/* Why the asset failed, when known */
+	FString Reason;
+
+	double Seconds = 0.0;
+
+	/* Seconds spent in every phase (see EImportTracePhase) */
+	TMap<FString, double> Phases;
+};
+
+struct JSONASASSET_API FImportReportTypeTiming {
+	int32 Count = 0;
+	int32 Failed = 0;
+	double Seconds = 0.0;
+
+	TMap<FString, double> Phases;
+};
+
+/* Differences between a session and the one before it, assets are matched by package */
+struct JSONASASSET_API FImportReportComparison {
+	/* Path of the report compared against, empty when there wasn't one */
+	FString PreviousReport;
+
+	/* Failed now, imported (or skipped) last time */
+	TArray<FString> NewFailures;
+
+	/* Imported now, failed last time */
+	TArray<FString> Fixed;
+
+	/* Seconds spent on every type, compared to last time */
+	TMap<FString, double> TypeSecondsDelta;
+};
+
+/* Everything one import session did */
+struct JSONASASSET_API FImportReportData {
+	FDateTime Started;
+	double Seconds = 0.0;
+
+	/* Seconds of every phase over the whole session, including work outside of assets (parsing files) */
+	TMap<FString, double> Phases;
+
+	int32 Files = 0;
+
+	TArray<TSharedPtr<FImportReportEntry>> Entries;
+	TMap<FString, FImportReportTypeTiming> Types;
+
+	/* References that couldn't be loaded or downloaded, and how often they were asked for */
+	TMap<FString, int32> UnresolvedReferences;
+
+	FImportReportComparison Comparison;
+
+	int32 Count(EImportReportStatus Status) const;
+
+	TSharedRef<FJsonObject> ToJson() const;
+	static bool FromJson(const TSharedPtr<FJsonObject>& Object, FImportReportData& OutReport);
+
+	FString ToString() const;
+};
+
+/*
+ * Collects the outcome of every asset imported during a session.
+ *
+ * While a session is active, imports don't show a notification per asset, whoever
+ * started the session shows one aggregated progress indicator instead. When the session
+ * ends the report is compared with the previous one, saved as json to
+ * Saved/JsonAsAsset/ImportReports/ and shown in the Import Report panel.
+ *
+ * Game thread only.
+ */
+class JSONASASSET_API FImportReport {
+public:
+	/* Sessions can be nested, only the outermost one produces a report */
+	static void BeginSession();
+
+	/* Saves the report and returns its path, empty for nested sessions */
+	static FString EndSession();
+
+	static bool IsSessionActive();
+
+	static void RecordFile();
+	static void RecordAsset(const FImportReportEntry& Entry);
+	static void RecordUnresolvedReference(const FString& Reference);
+
+	/* The report of the last finished session */
+	static TSharedPtr<const FImportReportData> GetLastReport();
+
+	/* Broadcast whenever a session finished */
+	static FSimpleMulticastDelegate& OnReportUpdated();
+
+	static FString GetReportDirectory();
+
+	static bool LoadReport(const FString& Path, FImportReportData& OutReport);
+
+	static FImportReportComparison Compare(const FImportReportData& Previous, const FImportReportData& Current);
+
+	static const TCHAR* StatusToString(EImportReportStatus Status);
+};
@@ -0,0 +1,71 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+/* Enable with -trace=cpu,JsonAsAsset (or "Trace.Enable JsonAsAsset" in the console) */
+UE_TRACE_CHANNEL_EXTERN(JsonAsAssetChannel, JSONASASSET_API)
+
+/* Where import time goes, reported per asset type at the end of a session */
+enum class EImportTracePhase : uint8 {
+	ParseJson,
+	Import,
+	DeserializeExports,
+	DeserializeProperties,
+	LoadReferences,
+	DecompressTextures,
+	RemoteRequests,
+	SavePackages,
+	CompileMaterials,
+	ImportCurves,
+	CompressAnimations,
+
+	Count
+};
+
+/*
+ * Import timing, both as Unreal Insights scopes on the JsonAsAsset trace channel and
+ * as plain per-phase totals for the import report.
+ *
+ * Phase time is inclusive and counted once per thread, a property deserializing a
+ * struct that deserializes more properties is one DeserializeProperties interval.
+ * Time spent on worker threads is added too, so phases can add up to more than the
+ * wall time of an asset. Insights counters are only incremented on the game thread.
+ */
+class JSONASASSET_API FImportTrace {
+public:
+	class JSONASASSET_API FPhaseScope {
+	public:
+		explicit FPhaseScope(EImportTracePhase InPhase);
+		~FPhaseScope();
+
+	private:
+		EImportTracePhase Phase;
+		uint64 StartCycles;
+		bool bOutermost;
+	};
+
+	/* Total cycles of every phase so far, taken before and after a piece of work */
+	struct FSnapshot {
+		uint64 Cycles[static_cast<int32>(EImportTracePhase::Count)] = {};
+	};
+
+	static FSnapshot TakeSnapshot();
+
+	/* Seconds of every phase that had any time between the snapshot and now */
+	static TMap<FString, double> GetSecondsSince(const FSnapshot& Snapshot);
+
+	static const TCHAR* PhaseToString(EImportTracePhase Phase);
+
+	/* Adds to the deserialized properties counter, for work done on worker threads */
+	static void CountPropertiesDeserialized(int32 Num);
+};
+
+/* Insights scope plus phase timing, Name is a string literal */
+#define JSONASASSET_TRACE_SCOPE(Name, Phase) \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("JsonAsAsset::" Name, JsonAsAssetChannel) \
+	const FImportTrace::FPhaseScope PREPROCESSOR_JOIN(ImportTracePhase_, __LINE__)(EImportTracePhase::Phase);
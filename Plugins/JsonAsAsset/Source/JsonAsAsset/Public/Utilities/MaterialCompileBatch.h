@@ -0,0 +1,39 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MaterialShared.h"
+
+/*
+ * Defers material compilation while a batch of files is imported.
+ *
+ * Importing a material, function or instance normally compiles it right away, and
+ * every material using a function (or instance of a parent) compiles again when that
+ * changes. While a batch is active those assets are only collected, at the end every
+ * one of them is compiled once: functions, then materials, then instances from the
+ * top of their parent chain down, all in one material update context.
+ *
+ * Game thread only.
+ */
+class JSONASASSET_API FMaterialCompileBatch {
+public:
+	using FWork = TFunction<void(FMaterialUpdateContext&)>;
+
+	/* Batches nest, only the outermost one compiles */
+	static void Begin();
+
+	/* Compiles everything deferred when the outermost batch ends, returns the seconds it took */
+	static double End();
+
+	static bool IsActive();
+
+	/*
+	 * Defers compiling a material, material function or material instance. Work runs right
+	 * before the asset compiles (e.g. updating an instance's static permutation).
+	 *
+	 * Returns false when nothing is batching or the asset isn't a material type, the caller
+	 * compiles it as usual then.
+	 */
+	static bool Defer(UObject* Asset, FWork Work = nullptr);
+};
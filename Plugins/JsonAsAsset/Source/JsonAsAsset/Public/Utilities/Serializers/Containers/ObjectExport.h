@@ -58,11 +58,28 @@ struct FUObjectExportContainer {
 	
 	FUObjectExportContainer() {};
 
+	/* Index of the first export with a name, INDEX_NONE if there is none */
+	int32 IndexOf(const FName Name) const {
+		if (IndexedNum != Exports.Num()) {
+			RebuildNameIndex();
+		}
+
+		const int32* Index = NameIndex.Find(Name);
+
+		/* Exports are public and may have been edited in place, verify before trusting the index */
+		if (Index != nullptr && (!Exports.IsValidIndex(*Index) || Exports[*Index].Name != Name)) {
+			RebuildNameIndex();
+			Index = NameIndex.Find(Name);
+		}
+
+		return Index != nullptr ? *Index : INDEX_NONE;
+	}
+
 	FUObjectExport& Find(const FName Name) {
-		for (FUObjectExport& Export : Exports) {
-			if (Export.Name == Name) {
-				return Export;
-			}
+		const int32 Index = IndexOf(Name);
+
+		if (Index != INDEX_NONE) {
+			return Exports[Index];
 		}
 
 		static FUObjectExport Dummy;
@@ -71,13 +88,9 @@ struct FUObjectExportContainer {
 
 	template<typename T>
 	T* Find(const FName Name) const {
-		for (FUObjectExport Export : Exports) {
-			if (Export.Name == Name) {
-				return Export.Get<T>();
-			}
-		}
+		const int32 Index = IndexOf(Name);
 
-		return nullptr;
+		return Index != INDEX_NONE ? Exports[Index].Get<T>() : nullptr;
 	}
 
 	FUObjectExport Find(const FName Name, const FName Outer) {
@@ -146,21 +159,35 @@ struct FUObjectExportContainer {
 		return FindByType(FName(*Type), FName(*Outer));
 	}
 	
-	bool Contains(const FName Name) {
-		for (FUObjectExport Export : Exports) {
-			if (Export.Name == Name) {
-				return true;
-			}
-		}
-
-		return false;
+	bool Contains(const FName Name) const {
+		return IndexOf(Name) != INDEX_NONE;
 	}
 
 	void Empty() {
 		Exports.Empty();
+		NameIndex.Empty();
+		IndexedNum = 0;
 	}
 	
 	int Num() const {
 		return Exports.Num();
 	}
+
+private:
+	/* Built on the first lookup and whenever exports were added or removed since */
+	mutable TMap<FName, int32> NameIndex;
+	mutable int32 IndexedNum = 0;
+
+	void RebuildNameIndex() const {
+		NameIndex.Reset();
+		NameIndex.Reserve(Exports.Num());
+
+		for (int32 Index = 0; Index < Exports.Num(); Index++) {
+			if (!NameIndex.Contains(Exports[Index].Name)) {
+				NameIndex.Add(Exports[Index].Name, Index);
+			}
+		}
+
+		IndexedNum = Exports.Num();
+	}
 };
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "ObjectUtilities.generated.h"
 
 class UPropertySerializer;
+class UStaticMeshComponent;
 
 UCLASS()
 class JSONASASSET_API UObjectSerializer : public UObject {
@@ -25,6 +26,14 @@ public:
     void DeserializeExports(TArray<TSharedPtr<FJsonValue>> InExports);
     void DeserializeExport(FUObjectExport& Export, TMap<TSharedPtr<FJsonObject>, UObject*>& ExportsMap);
 
+    /*
+     * Reimport mode: existing subobjects are reused, and properties are only written when
+     * their deserialized value differs from the current one. Properties missing from the
+     * json are reset to their archetype's value, like a fresh import would have them.
+     */
+    void BeginPropertyDelta();
+    FORCEINLINE bool HasPropertyChanges() const { return ChangedPropertyCount > 0; }
+
     UPROPERTY()
     UObject* Parent;
 
@@ -40,4 +49,26 @@ public:
     TArray<FString> ExportsToNotDeserialize;
 
     TArray<FString> PathsToNotDeserialize;
+
+protected:
+    bool DeserializePropertyDelta(FProperty* Property, const TSharedPtr<FJsonValue>& Value, void* PropertyValue) const;
+
+    /* Runs a write against a scratch copy of the property, returns true (and keeps it) if the value changed */
+    bool WritePropertyDelta(FProperty* Property, void* PropertyValue, TFunctionRef<void(void*)> Write) const;
+    void ResetMissingProperties(const TSharedPtr<FJsonObject>& Properties, UObject* Object) const;
+
+    /* Decodes LODData vertex colors straight into each LOD's color vertex buffer */
+    void DeserializeVertexColors(const TArray<TSharedPtr<FJsonValue>>& ObjectLODData, UStaticMeshComponent* StaticMeshComponent) const;
+
+    /* Initializes the render resources of every decoded buffer at once */
+    void InitPendingVertexColors() const;
+
+    /* Components with vertex color buffers that haven't been initialized yet */
+    mutable TArray<TWeakObjectPtr<UStaticMeshComponent>> PendingVertexColorComponents;
+
+    /* Set while DeserializeExports runs, so buffers are initialized after the last component */
+    bool bDeserializingExports = false;
+
+    bool bApplyPropertyDelta = false;
+    mutable int32 ChangedPropertyCount = 0;
 };
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include "ObjectUtilities.h"
 #include "Containers/ObjectExport.h"
+#include "ReferenceResolver.h"
 #include "Dom/JsonObject.h"
 #include "Structs/StructSerializer.h"
 #include "UObject/Object.h"
@@ -25,6 +26,13 @@ public:
 	}
 };
 
+/* A plain data property value waiting to be written, see UPropertySerializer::DeserializePlainDataProperties */
+struct FPlainDataPropertyWrite {
+	FProperty* Property;
+	TSharedPtr<FJsonValue> Value;
+	void* PropertyValue;
+};
+
 UCLASS()
 class JSONASASSET_API UPropertySerializer : public UObject
 {
@@ -47,8 +55,17 @@ public:
 	bool bFallbackToParentTrace = true;
 
 	FUObjectExportContainer ExportsContainer;
+
+	/*
+	 * Subobjects of a graph being built (e.g. material expressions). While set, references
+	 * to them link directly instead of being loaded by path.
+	 */
+	const FUObjectExportContainer* LocalExports = nullptr;
 	TArray<FString> BlacklistedPropertyNames;
 	TArray<FFailedPropertyInfo> FailedProperties;
+
+	/* Deduplicates object references across every property of an import */
+	FReferenceResolver ReferenceResolver;
 	
 	void ClearCachedData();
 
@@ -61,8 +78,33 @@ public:
 
 	void DeserializePropertyValue(FProperty* Property, const TSharedRef<FJsonValue>& Value, void* OutValue);
 	void DeserializeStruct(UScriptStruct* Struct, const TSharedRef<FJsonObject>& Value, void* OutValue) const;
+
+	/*
+	 * Plain data (numbers, strings, names, enums, plain structs and containers of those)
+	 * never looks up other objects, so it can be deserialized off the game thread.
+	 */
+	bool IsPlainDataProperty(const FProperty* Property) const;
+
+	/* Whether a whole struct can be deserialized off the game thread (e.g. data table rows) */
+	bool IsPlainDataStruct(const UScriptStruct* Struct) const;
+
+	/*
+	 * Writes an object's plain data properties using every core, in batches so small objects
+	 * are written serially. Every write goes to its own memory, so the result is the same as
+	 * writing them one after another. Structs write theirs in place, wide ones (data table rows)
+	 * are spread over cores a whole struct at a time instead.
+	 *
+	 * Callers queue these while deserializing an object and write them at the end, so plain
+	 * data properties land after every other property of the object rather than in declaration
+	 * order. Nothing reads properties while they're written, PostEditChange runs after both.
+	 */
+	void DeserializePlainDataProperties(const TArray<FPlainDataPropertyWrite>& Writes);
 private:
 	FStructSerializer* GetStructSerializer(const UScriptStruct* Struct) const;
+
+	/* Results of IsPlainDataProperty, only accessed on the game thread */
+	mutable TMap<const FProperty*, bool> PlainDataProperties;
+	mutable TMap<const UScriptStruct*, bool> PlainDataStructs;
 };
 
 /* Use to handle differentiating formats produced by CUE4Parse */
@@ -0,0 +1,44 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+class IImporter;
+
+/*
+ * Resolves object references found while deserializing properties.
+ *
+ * Large exports reference the same meshes, materials and textures thousands of times.
+ * Every package referenced by a file is loaded up front in one batch of async loads,
+ * after that each unique reference is only resolved once (misses included, so Cloud
+ * isn't asked for the same missing asset over and over).
+ */
+class JSONASASSET_API FReferenceResolver {
+public:
+	FReferenceResolver();
+	~FReferenceResolver();
+
+	/* Loads every package referenced by the exports as one batch, returns how many were requested */
+	static int32 PrefetchReferences(const TArray<TSharedPtr<FJsonValue>>& Exports);
+
+	/* Converts an ObjectPath into the long package name it's loaded from */
+	static FString ToLongPackageName(FString Path);
+
+	/* Resolves a package index (ObjectName + ObjectPath) */
+	UObject* Resolve(const TSharedPtr<FJsonObject>& PackageIndex, UObject* ParentObject);
+
+	/* Makes sure a soft object path is loaded, falling back to Cloud */
+	void ResolveSoftPath(const FString& Path, const FString& ClassName);
+
+	void Reset();
+
+private:
+	/* Single importer used to load references, instead of one per property */
+	TUniquePtr<IImporter> Importer;
+
+	TMap<FString, TWeakObjectPtr<UObject>> ResolvedObjects;
+	TSet<FString> UnresolvedReferences;
+	TSet<FString> ResolvedSoftPaths;
+};
@@ -0,0 +1,44 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/* One generated export file */
+struct JSONASASSET_API FSyntheticExport {
+	FString File;
+	FString Type;
+
+	/* Object path of the asset the file creates, e.g. /Game/JsonAsAssetBenchmark/Tables/DT_Benchmark_0.DT_Benchmark_0 */
+	FString ObjectPath;
+
+	/* Rows, curves, expressions, nodes, bodies or references the imported asset must end up with */
+	int32 ExpectedElements = 0;
+};
+
+/*
+ * Writes CUE4Parse shaped export files with made up content, for benchmarking imports.
+ *
+ * The same seed and scale always produce byte identical files, so timings of two
+ * commits are comparable. Every asset only references engine types and exports in its
+ * own file (data assets reference the other generated assets), nothing needs Cloud.
+ */
+class JSONASASSET_API FSyntheticExportGenerator {
+public:
+	struct FOptions {
+		int32 Seed = 1;
+
+		/* Multiplies the element count of every asset */
+		float Scale = 1.0f;
+
+		int32 AssetsPerType = 2;
+
+		/* Types to generate, empty for every supported type */
+		TArray<FString> Types;
+	};
+
+	/* Generates the files under Root/<Folder>/Content/JsonAsAssetBenchmark, data assets last */
+	static TArray<FSyntheticExport> Generate(const FString& Root, const FOptions& Options);
+
+	static const TArray<FString>& GetSupportedTypes();
+};
@@ -0,0 +1,46 @@
+/* Copyright JsonAsAsset Contributors 2024-2025 */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utilities/Compatibility.h"
+
+struct FSlateBrush;
+
+/*
+ * Session cache for resolving type names found in exports.
+ *
+ * Searching every loaded object for a class by its short name is slow, and the same
+ * types are looked up for every export, subobject and graph node. Results are remembered
+ * until modules change, code is reloaded or a new import starts. Misses are forgotten
+ * when a struct, enum or blueprint class is imported, since that may have created the type.
+ *
+ * Game thread only.
+ */
+class JSONASASSET_API FTypeResolver {
+public:
+	/* Finds a class by its short name (e.g. "StaticMesh") */
+	static UClass* FindClass(const FString& Name);
+
+	/* Finds a class by its full path (e.g. "/Script/Engine.StaticMesh") */
+	static UClass* FindClassByPath(const FString& Path);
+
+	/* Caches a custom resolution (redirects, renamed classes) under a key */
+	static UClass* ResolveClass(const FString& Key, TFunctionRef<UClass*()> Resolver);
+
+	/* The class thumbnail brush of an engine type, used by notifications */
+	static const FSlateBrush* FindIcon(const FString& Type);
+
+	/* Clears every cached result */
+	static void Invalidate();
+
+	/* Clears only the failed lookups, found classes stay cached */
+	static void InvalidateMisses();
+
+	/* Incremented on every invalidation, so other caches can tell when to rebuild */
+	static uint32 GetGeneration();
+
+	/* Binds invalidation to module and reload events */
+	static void Initialize();
+	static void Shutdown();
+};